@@ -283,6 +283,9 @@ void publish_routine(
     std::vector<std::pair<std::filesystem::path, int32_t>> sample_files;
     get_sorted_files(publish_path, sample_files);
 
+    // Resolve the topic once (retrying until it succeeds), so it is not looked up on every publication
+    eprosima::ddsenabler::participants::TopicHandle topic_handle;
+
     for (const auto& [path, number] : sample_files)
     {
         std::ifstream file(path, std::ios::binary);
@@ -290,7 +293,8 @@ void publish_routine(
         {
             std::string file_content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-            if (enabler->publish(topic_name, file_content))
+            if ((topic_handle.valid() || enabler->resolve_topic(topic_name, topic_handle)) &&
+                    enabler->publish(topic_handle, file_content))
             {
                 std::cout << "Published content from file: " << path.filename() << " in topic: "
                           << topic_name << std::endl;
@@ -42,6 +42,13 @@ struct DdsCallbacks
 
     //! Callback for requesting information of a DDS topic
     participants::DdsTopicQuery topic_query{nullptr};
+
+    //! Callback for notifying the reception of DDS data in its serialized form (JSON conversion is skipped if
+    //! \c data_notification is not set)
+    participants::DdsDataRawNotification data_raw_notification{nullptr};
+
+    //! Callback for notifying the reception of several DDS data at once (see \c data-batch configuration)
+    participants::DdsDataBatchNotification data_batch_notification{nullptr};
 };
 
 /**
@@ -19,6 +19,9 @@
 #pragma once
 
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 
@@ -37,7 +40,11 @@
 #include <ddsenabler_participants/CBHandler.hpp>
 #include <ddsenabler_participants/CBHandlerConfiguration.hpp>
 #include <ddsenabler_participants/DdsParticipant.hpp>
+#include <ddsenabler_participants/DeliveryQueue.hpp>
 #include <ddsenabler_participants/EnablerParticipant.hpp>
+#include <ddsenabler_participants/PayloadLoan.hpp>
+#include <ddsenabler_participants/TopicHandle.hpp>
+#include <ddsenabler_participants/TypeCodec.hpp>
 
 #include <ddsenabler_yaml/EnablerConfiguration.hpp>
 
@@ -103,6 +110,186 @@ public:
             const std::string& topic_name,
             const std::string& json);
 
+    /**
+     * Resolve a topic to publish in, so subsequent publications do not need to look it up by name.
+     *
+     * @param topic_name: The name of the topic to resolve.
+     * @param handle: The handle of the topic, valid while this enabler exists.
+     * @return \c true if the topic was resolved successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool resolve_topic(
+            const std::string& topic_name,
+            participants::TopicHandle& handle);
+
+    /**
+     * Publish a JSON message to a topic previously resolved with \c resolve_topic .
+     *
+     * @param handle: The handle of the topic to publish to.
+     * @param json: The JSON message to publish.
+     * @return \c true if the message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish(
+            const participants::TopicHandle& handle,
+            const std::string& json);
+
+    /**
+     * Publish an already serialized (CDR) message to the specified topic, without any conversion.
+     *
+     * @param topic_name: The name of the topic to publish to.
+     * @param serialized_data: The serialized message, starting with its encapsulation header.
+     * @param serialized_data_size: The size of the serialized message.
+     * @param encapsulation: The encapsulation (data representation and endianness) of the serialized message.
+     * @param validate: Whether to check the encapsulation header and size of the message before publishing it.
+     * @return \c true if the message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish_serialized(
+            const std::string& topic_name,
+            const unsigned char* serialized_data,
+            uint32_t serialized_data_size,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * Publish an already serialized (CDR) message to a topic previously resolved with \c resolve_topic .
+     *
+     * @param handle: The handle of the topic to publish to.
+     * @param serialized_data: The serialized message, starting with its encapsulation header.
+     * @param serialized_data_size: The size of the serialized message.
+     * @param encapsulation: The encapsulation (data representation and endianness) of the serialized message.
+     * @param validate: Whether to check the encapsulation header and size of the message before publishing it.
+     * @return \c true if the message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish_serialized(
+            const participants::TopicHandle& handle,
+            const unsigned char* serialized_data,
+            uint32_t serialized_data_size,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * Loan a payload to serialize a message straight into it, to be published with \c commit_payload without copies.
+     *
+     * @param handle: The handle of the topic to publish to.
+     * @param size: The size of the serialized message, including its encapsulation header.
+     * @param loan: The loan holding the payload.
+     * @return \c true if the payload was loaned successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool loan_payload(
+            const participants::TopicHandle& handle,
+            uint32_t size,
+            participants::PayloadLoan& loan);
+
+    /**
+     * Publish the message serialized in a loaned payload. The loan is consumed if the message is published.
+     *
+     * @param loan: The loan holding the serialized message, obtained with \c loan_payload .
+     * @param encapsulation: The encapsulation (data representation and endianness) of the serialized message.
+     * @param validate: Whether to check the encapsulation header and size of the message before publishing it.
+     * @return \c true if the message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool commit_payload(
+            participants::PayloadLoan& loan,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * Create the specified topics (and their writers) in the background, so their first publication is not delayed.
+     *
+     * Topics are resolved concurrently, requesting their type and QoS through the corresponding callbacks if unknown.
+     *
+     * @param topic_names: The names of the topics to be published to.
+     */
+    DDSENABLER_DllAPI
+    void declare_publish_topics(
+            const std::set<std::string>& topic_names);
+
+    /**
+     * Publish a JSON message to the specified topic, without blocking if the topic has to be created first.
+     *
+     * Messages to topics not ready yet are queued (in order) until the topic is created in the background.
+     *
+     * @param topic_name: The name of the topic to publish to.
+     * @param json: The JSON message to publish.
+     * @param callback: Function notified of whether the message was published successfully (may be empty).
+     */
+    DDSENABLER_DllAPI
+    void publish_async(
+            const std::string& topic_name,
+            const std::string& json,
+            participants::EnablerParticipant::PublishCompletion callback = nullptr);
+
+    /**
+     * Publish several JSON messages to the specified topic, resolving it only once.
+     *
+     * @param topic_name: The name of the topic to publish to.
+     * @param jsons: The JSON messages to publish, in publication order.
+     * @param results: Whether each message was published successfully.
+     * @return \c true if every message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish_batch(
+            const std::string& topic_name,
+            const std::vector<std::string>& jsons,
+            std::vector<bool>& results);
+
+    /**
+     * Publish several JSON messages to a topic previously resolved with \c resolve_topic .
+     *
+     * @param handle: The handle of the topic to publish to.
+     * @param jsons: The JSON messages to publish, in publication order.
+     * @param results: Whether each message was published successfully.
+     * @return \c true if every message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish_batch(
+            const participants::TopicHandle& handle,
+            const std::vector<std::string>& jsons,
+            std::vector<bool>& results);
+
+    /**
+     * Publish the JSON messages contained in a JSON array or in NDJSON text (one message per line).
+     *
+     * @param topic_name: The name of the topic to publish to.
+     * @param batch: The JSON array or NDJSON text containing the messages to publish.
+     * @param results: Whether each message was published successfully.
+     * @return \c true if every message was published successfully, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool publish_batch_json(
+            const std::string& topic_name,
+            const std::string& batch,
+            std::vector<bool>& results);
+
+    /**
+     * Get the usage counters (queue depth, dropped and coalesced samples) of the delivery queue of a topic.
+     *
+     * @param topic_name: The name of the topic.
+     * @param statistics: The usage counters of the delivery queue of the topic.
+     * @return \c true if samples of the topic have been queued, \c false otherwise (or if no queue is configured).
+     */
+    DDSENABLER_DllAPI
+    bool get_delivery_statistics(
+            const std::string& topic_name,
+            participants::DeliveryQueueStatistics& statistics) const;
+
+    /**
+     * Get the usage counters (requested and allocated DynamicData objects) of the DynamicData pool of a type.
+     *
+     * @param type_name: The name of the type.
+     * @param statistics: The usage counters of the DynamicData pool of the type.
+     * @return \c true if the type is known, \c false otherwise.
+     */
+    DDSENABLER_DllAPI
+    bool get_dynamic_data_statistics(
+            const std::string& type_name,
+            participants::DynamicDataPoolStatistics& statistics) const;
+
 protected:
 
     /**
@@ -46,19 +46,20 @@ DDSEnabler::DDSEnabler(
     // Create Thread Pool
     thread_pool_ = std::make_shared<SlotThreadPool>(configuration_.n_threads);
 
-    // Create CB Handler configuration
-    participants::CBHandlerConfiguration handler_config;
+    // Create Writer Match Tracker, shared by the DDS Participant (feeding it) and the Enabler Participant (waiting on it)
+    auto match_tracker = std::make_shared<participants::WriterMatchTracker>();
 
     // Create DDS Participant
     dds_participant_ = std::make_shared<DdsParticipant>(
         configuration_.simple_configuration,
         payload_pool_,
-        discovery_database_);
+        discovery_database_,
+        match_tracker);
     dds_participant_->init();
 
     // Create CB Handler
     cb_handler_ = std::make_shared<participants::CBHandler>(
-        handler_config,
+        configuration_.handler_configuration,
         payload_pool_);
 
     // Create Enabler Participant
@@ -66,7 +67,9 @@ DDSEnabler::DDSEnabler(
         configuration_.enabler_configuration,
         payload_pool_,
         discovery_database_,
-        cb_handler_);
+        cb_handler_,
+        match_tracker,
+        thread_pool_);
 
     // Create Participant Database
     participants_database_ = std::make_shared<ParticipantsDatabase>();
@@ -98,6 +101,9 @@ DDSEnabler::DDSEnabler(
         throw utils::InitializationException(
                   utils::Formatter() << "Failed to enable DDS Pipe.");
     }
+
+    // Create the topics to be published to beforehand, once the pipe is enabled and the callbacks set
+    declare_publish_topics(configuration_.enabler_configuration->publish_topics);
 }
 
 bool DDSEnabler::set_file_watcher(
@@ -201,6 +207,14 @@ void DDSEnabler::set_internal_callbacks_(
     {
         cb_handler_->set_data_notification_callback(callbacks.dds.data_notification);
     }
+    if (callbacks.dds.data_raw_notification)
+    {
+        cb_handler_->set_data_raw_notification_callback(callbacks.dds.data_raw_notification);
+    }
+    if (callbacks.dds.data_batch_notification)
+    {
+        cb_handler_->set_data_batch_notification_callback(callbacks.dds.data_batch_notification);
+    }
     if (callbacks.dds.type_query)
     {
         cb_handler_->set_type_query_callback(callbacks.dds.type_query);
@@ -218,5 +232,112 @@ bool DDSEnabler::publish(
     return enabler_participant_->publish(topic_name, json);
 }
 
+bool DDSEnabler::resolve_topic(
+        const std::string& topic_name,
+        participants::TopicHandle& handle)
+{
+    return enabler_participant_->resolve_topic(topic_name, handle);
+}
+
+bool DDSEnabler::publish(
+        const participants::TopicHandle& handle,
+        const std::string& json)
+{
+    return enabler_participant_->publish(handle, json);
+}
+
+bool DDSEnabler::publish_serialized(
+        const std::string& topic_name,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation,
+        bool validate)
+{
+    return enabler_participant_->publish_serialized(topic_name, serialized_data, serialized_data_size, encapsulation,
+                   validate);
+}
+
+bool DDSEnabler::publish_serialized(
+        const participants::TopicHandle& handle,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation,
+        bool validate)
+{
+    return enabler_participant_->publish_serialized(handle, serialized_data, serialized_data_size, encapsulation,
+                   validate);
+}
+
+bool DDSEnabler::loan_payload(
+        const participants::TopicHandle& handle,
+        uint32_t size,
+        participants::PayloadLoan& loan)
+{
+    return enabler_participant_->loan_payload(handle, size, loan);
+}
+
+bool DDSEnabler::commit_payload(
+        participants::PayloadLoan& loan,
+        uint16_t encapsulation,
+        bool validate)
+{
+    return enabler_participant_->commit_payload(loan, encapsulation, validate);
+}
+
+void DDSEnabler::declare_publish_topics(
+        const std::set<std::string>& topic_names)
+{
+    for (const std::string& topic_name : topic_names)
+    {
+        enabler_participant_->declare_topic(topic_name);
+    }
+}
+
+void DDSEnabler::publish_async(
+        const std::string& topic_name,
+        const std::string& json,
+        participants::EnablerParticipant::PublishCompletion callback)
+{
+    enabler_participant_->publish_async(topic_name, json, std::move(callback));
+}
+
+bool DDSEnabler::publish_batch(
+        const std::string& topic_name,
+        const std::vector<std::string>& jsons,
+        std::vector<bool>& results)
+{
+    return enabler_participant_->publish_batch(topic_name, jsons, results);
+}
+
+bool DDSEnabler::publish_batch(
+        const participants::TopicHandle& handle,
+        const std::vector<std::string>& jsons,
+        std::vector<bool>& results)
+{
+    return enabler_participant_->publish_batch(handle, jsons, results);
+}
+
+bool DDSEnabler::publish_batch_json(
+        const std::string& topic_name,
+        const std::string& batch,
+        std::vector<bool>& results)
+{
+    return enabler_participant_->publish_batch_json(topic_name, batch, results);
+}
+
+bool DDSEnabler::get_delivery_statistics(
+        const std::string& topic_name,
+        participants::DeliveryQueueStatistics& statistics) const
+{
+    return cb_handler_->get_delivery_statistics(topic_name, statistics);
+}
+
+bool DDSEnabler::get_dynamic_data_statistics(
+        const std::string& type_name,
+        participants::DynamicDataPoolStatistics& statistics) const
+{
+    return cb_handler_->get_dynamic_data_statistics(type_name, statistics);
+}
+
 } /* namespace ddsenabler */
 } /* namespace eprosima */
@@ -12,11 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <map>
 #include <mutex>
+#include <string>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
@@ -38,6 +43,7 @@ struct KnownType
     DynamicType::_ref_type dyn_type_;
     TypeSupport type_sup_;
     DataWriter* writer_ = nullptr;
+    DataReader* reader_ = nullptr;
 };
 
 const unsigned int DOMAIN_ = 33;
@@ -46,6 +52,7 @@ static int wait_after_writer_creation_ms_ =  300;
 static int write_delay_ms_ =  20;
 static int wait_for_ack_ns_ =  1000000000;
 static int wait_after_publication_ms_ =  200;
+static int wait_for_samples_ms_ =  5000;
 
 class DDSEnablerTester : public ::testing::Test
 {
@@ -58,6 +65,10 @@ public:
         received_types_ = 0;
         received_topics_ = 0;
         received_data_ = 0;
+        received_topic_queries_ = 0;
+        known_topics_.clear();
+        topic_query_delay_ms_ = 0;
+        data_notification_delay_ms_ = 0;
         current_test_instance_ = this;  // Set the current instance for callbacks
     }
 
@@ -100,6 +111,34 @@ public:
         return enabler;
     }
 
+    // Create the DDSEnabler with the given YAML configuration and bind the static callbacks
+    std::shared_ptr<DDSEnabler> create_ddsenabler_w_config(
+            const char* yml_str)
+    {
+        eprosima::Yaml yml = YAML::Load(yml_str);
+        eprosima::ddsenabler::yaml::EnablerConfiguration configuration(yml);
+        configuration.simple_configuration->domain = DOMAIN_;
+
+        eprosima::utils::Formatter error_msg;
+        if (!configuration.is_valid(error_msg))
+        {
+            return nullptr;
+        }
+
+        CallbackSet callbacks{
+            test_log_callback,
+            {
+                test_type_notification_callback,
+                test_topic_notification_callback,
+                test_data_notification_callback,
+                test_type_query_callback,
+                test_topic_query_callback
+            }
+        };
+
+        return std::make_shared<DDSEnabler>(configuration, callbacks);
+    }
+
     // Create the DDSEnabler and bind the static callbacks
     std::shared_ptr<DDSEnabler> create_ddsenabler_w_history()
     {
@@ -234,6 +273,91 @@ public:
         return true;
     }
 
+    bool create_subscriber(
+            KnownType& a_type)
+    {
+        DomainParticipant* participant = DomainParticipantFactory::get_instance()
+                        ->create_participant(DOMAIN_, PARTICIPANT_QOS_DEFAULT);
+        if (participant == nullptr)
+        {
+            std::cout << "ERROR DDSEnablerTester: create_participant" << std::endl;
+            return false;
+        }
+
+        if (RETCODE_OK != a_type.type_sup_.register_type(participant))
+        {
+            std::cout << "ERROR DDSEnablerTester: fail to register type: " <<
+                a_type.type_sup_.get_type_name() << std::endl;
+            return false;
+        }
+
+        Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        if (subscriber == nullptr)
+        {
+            std::cout << "ERROR DDSEnablerTester: create_subscriber: " <<
+                a_type.type_sup_.get_type_name() << std::endl;
+            return false;
+        }
+
+        Topic* topic = participant->create_topic(get_topic_name(a_type), a_type.type_sup_.get_type_name(),
+                        TOPIC_QOS_DEFAULT);
+        if (topic == nullptr)
+        {
+            std::cout << "ERROR DDSEnablerTester: create_topic: " <<
+                a_type.type_sup_.get_type_name() << std::endl;
+            return false;
+        }
+
+        // Keep every sample received, so they can be counted
+        DataReaderQos rqos = subscriber->get_default_datareader_qos();
+        rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+        a_type.reader_ = subscriber->create_datareader(topic, rqos);
+        if (a_type.reader_ == nullptr)
+        {
+            std::cout << "ERROR DDSEnablerTester: create_datareader: " <<
+                a_type.type_sup_.get_type_name() << std::endl;
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(wait_after_writer_creation_ms_));
+        return true;
+    }
+
+    // Wait until the reader of the given type has received (at least) the given number of samples
+    bool wait_for_samples(
+            KnownType& a_type,
+            uint64_t samples)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_for_samples_ms_);
+        while (a_type.reader_->get_unread_count() < samples)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                std::cout << "ERROR DDSEnablerTester: fail waiting for samples: " <<
+                    a_type.type_sup_.get_type_name() << std::endl;
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(write_delay_ms_));
+        }
+        return true;
+    }
+
+    // Name of the topic of the given type
+    static std::string get_topic_name(
+            const KnownType& a_type)
+    {
+        return a_type.type_sup_.get_type_name() + "TopicName";
+    }
+
+    // Let the topic query callback provide the topic of the given type, registering the type so it is known locally
+    void add_known_topic(
+            KnownType& a_type)
+    {
+        a_type.type_sup_->register_type_object_representation();
+
+        std::lock_guard<std::mutex> lock(topic_query_mutex_);
+        known_topics_[get_topic_name(a_type)] = a_type.type_sup_.get_type_name();
+    }
+
     bool send_samples(
             KnownType& a_type)
     {
@@ -270,6 +394,9 @@ public:
     {
         if (current_test_instance_)
         {
+            // Emulate a slow consumer
+            std::this_thread::sleep_for(std::chrono::milliseconds(current_test_instance_->data_notification_delay_ms_));
+
             std::lock_guard<std::mutex> lock(current_test_instance_->data_received_mutex_);
 
             current_test_instance_->received_data_++;
@@ -318,6 +445,27 @@ public:
             std::string& type_name,
             std::string& serialized_qos)
     {
+        if (current_test_instance_)
+        {
+            int delay_ms = 0;
+            bool known = false;
+            {
+                std::lock_guard<std::mutex> lock(current_test_instance_->topic_query_mutex_);
+
+                current_test_instance_->received_topic_queries_++;
+                delay_ms = current_test_instance_->topic_query_delay_ms_;
+                auto it = current_test_instance_->known_topics_.find(topic_name);
+                if (it != current_test_instance_->known_topics_.end())
+                {
+                    type_name = it->second;
+                    known = true;
+                }
+            }
+
+            // Emulate a user taking long to provide the topic
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+            return known;
+        }
         return false;
     }
 
@@ -382,6 +530,44 @@ public:
         }
     }
 
+    // Wait until the given number of samples have been notified, or the samples wait times out
+    bool wait_for_received_data(
+            int expected)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_for_samples_ms_);
+        while (get_received_data() < expected)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    }
+
+    void set_topic_query_delay(
+            int delay_ms)
+    {
+        std::lock_guard<std::mutex> lock(topic_query_mutex_);
+
+        topic_query_delay_ms_ = delay_ms;
+    }
+
+    int get_received_topic_queries()
+    {
+        if (current_test_instance_)
+        {
+            std::lock_guard<std::mutex> lock(current_test_instance_->topic_query_mutex_);
+
+            return current_test_instance_->received_topic_queries_;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
     // Pointer to the current test instance (for use in the static callback)
     static DDSEnablerTester* current_test_instance_;
 
@@ -389,11 +575,24 @@ public:
     int received_types_ = 0;
     int received_topics_ = 0;
     int received_data_ = 0;
+    int received_topic_queries_ = 0;
+
+    // Topics provided by the topic query callback, along with their type names
+    std::map<std::string, std::string> known_topics_;
+
+    // Time the topic query callback takes to answer
+    int topic_query_delay_ms_ = 0;
+
+    // Time the data notification callback takes to return (only set before creating the enabler)
+    int data_notification_delay_ms_ = 0;
 
     // Mutex for synchronizing access to received_types_, received_topics_ and received_data_
     std::mutex type_received_mutex_;
     std::mutex topic_received_mutex_;
     std::mutex data_received_mutex_;
+
+    // Mutex for synchronizing access to received_topic_queries_, known_topics_ and topic_query_delay_ms_
+    std::mutex topic_query_mutex_;
 };
 
 
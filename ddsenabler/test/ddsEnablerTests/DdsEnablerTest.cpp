@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -385,6 +390,452 @@ TEST_F(DDSEnablerTest, send_history_multiple_types)
     ASSERT_EQ(get_received_data(), types * history_depth);
 }
 
+TEST_F(DDSEnablerTest, publish_without_external_readers)
+{
+    auto enabler = create_ddsenabler_w_config(
+        R"(
+        ddsenabler:
+          initial-publish-wait: 1000
+          initial-publish-matched-readers: 1
+        )");
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+
+    // The reader created by the enabler itself in the topic does not count, so the first publication waits for an
+    // external reader until the deadline, and then publishes anyway
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(enabler->publish(get_topic_name(a_type), R"({"value": 1})"));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    ASSERT_EQ(get_received_topic_queries(), 1);
+
+    // Subsequent publications do not wait
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(enabler->publish(get_topic_name(a_type), R"({"value": 2})"));
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    ASSERT_EQ(get_received_topic_queries(), 1);
+}
+
+TEST_F(DDSEnablerTest, resolve_unknown_topic)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    // The topic query callback does not provide the topic
+    TopicHandle handle;
+    ASSERT_FALSE(enabler->resolve_topic("UnknownTopicName", handle));
+    ASSERT_FALSE(handle.valid());
+    ASSERT_EQ(get_received_topic_queries(), 1);
+
+    // Empty topic names are rejected without querying them
+    ASSERT_FALSE(enabler->resolve_topic("", handle));
+    ASSERT_FALSE(handle.valid());
+    ASSERT_EQ(get_received_topic_queries(), 1);
+
+    // Unresolved handles cannot be published in
+    ASSERT_FALSE(enabler->publish(handle, R"({"value": 1})"));
+}
+
+TEST_F(DDSEnablerTest, publish_with_topic_handle)
+{
+    ddsenablertester::num_samples_ = 3;
+
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+    ASSERT_TRUE(create_subscriber(a_type));
+
+    TopicHandle handle;
+    ASSERT_TRUE(enabler->resolve_topic(get_topic_name(a_type), handle));
+    ASSERT_TRUE(handle.valid());
+    ASSERT_EQ(handle.topic_name, get_topic_name(a_type));
+    ASSERT_EQ(handle.type_name, a_type.type_sup_.get_type_name());
+
+    for (int i = 0; i < num_samples_; i++)
+    {
+        ASSERT_TRUE(enabler->publish(handle, R"({"value": )" + std::to_string(i) + "}"));
+    }
+    ASSERT_TRUE(wait_for_samples(a_type, num_samples_));
+
+    // Samples not matching the topic type are rejected
+    ASSERT_FALSE(enabler->publish(handle, R"({"value": "not a number"})"));
+}
+
+TEST_F(DDSEnablerTest, topic_handle_valid_after_creating_topics)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+    ASSERT_TRUE(create_subscriber(a_type));
+
+    TopicHandle handle;
+    ASSERT_TRUE(enabler->resolve_topic(get_topic_name(a_type), handle));
+
+    // Create other topics after resolving the handle
+    KnownType other_type;
+    other_type.type_sup_.reset(new DDSEnablerTestType2PubSubType());
+    add_known_topic(other_type);
+    KnownType another_type;
+    another_type.type_sup_.reset(new DDSEnablerTestType3PubSubType());
+    add_known_topic(another_type);
+
+    ASSERT_TRUE(enabler->publish(get_topic_name(other_type), R"({"value": "other"})"));
+    ASSERT_TRUE(enabler->publish(get_topic_name(another_type), R"({"value": [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]})"));
+
+    // The handle still publishes in its topic, through the same reader it would be resolved to now
+    TopicHandle same_handle;
+    ASSERT_TRUE(enabler->resolve_topic(get_topic_name(a_type), same_handle));
+    ASSERT_EQ(handle.reader, same_handle.reader);
+
+    ASSERT_TRUE(enabler->publish(handle, R"({"value": 1})"));
+    ASSERT_TRUE(wait_for_samples(a_type, 1));
+}
+
+TEST_F(DDSEnablerTest, publish_batch)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+    ASSERT_TRUE(create_subscriber(a_type));
+
+    // Large enough to be serialized in several chunks, with a sample not matching the topic type
+    const size_t failed_sample = 150;
+    std::vector<std::string> jsons;
+    for (size_t i = 0; i < 200; i++)
+    {
+        jsons.push_back(i == failed_sample ? R"({"value": "not a number"})" :
+                R"({"value": )" + std::to_string(i) + "}");
+    }
+
+    // The failed sample does not prevent the rest from being published
+    std::vector<bool> results;
+    ASSERT_FALSE(enabler->publish_batch(get_topic_name(a_type), jsons, results));
+    ASSERT_EQ(results.size(), jsons.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_EQ(results[i], i != failed_sample);
+    }
+    ASSERT_TRUE(wait_for_samples(a_type, 1));
+
+    // Publish through a handle
+    jsons.erase(jsons.begin() + failed_sample);
+    TopicHandle handle;
+    ASSERT_TRUE(enabler->resolve_topic(get_topic_name(a_type), handle));
+    ASSERT_TRUE(enabler->publish_batch(handle, jsons, results));
+    ASSERT_EQ(results, std::vector<bool>(jsons.size(), true));
+
+    // Nothing is published in unknown topics
+    ASSERT_FALSE(enabler->publish_batch("UnknownTopicName", jsons, results));
+    ASSERT_EQ(results, std::vector<bool>(jsons.size(), false));
+}
+
+TEST_F(DDSEnablerTest, publish_batch_json)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+    const std::string topic_name = get_topic_name(a_type);
+
+    std::vector<bool> results;
+
+    // JSON array
+    ASSERT_TRUE(enabler->publish_batch_json(topic_name, R"([{"value": 1}, {"value": 2}, {"value": 3}])", results));
+    ASSERT_EQ(results, std::vector<bool>({true, true, true}));
+
+    // JSON array with an element not matching the topic type
+    ASSERT_FALSE(enabler->publish_batch_json(topic_name, R"( [{"value": 1}, {"value": "text"}, {"value": 3}])",
+            results));
+    ASSERT_EQ(results, std::vector<bool>({true, false, true}));
+
+    // Malformed JSON array: nothing is published
+    ASSERT_FALSE(enabler->publish_batch_json(topic_name, R"([{"value": 1}, {"value": )", results));
+    ASSERT_TRUE(results.empty());
+
+    // NDJSON with blank lines, which are ignored
+    ASSERT_TRUE(enabler->publish_batch_json(topic_name, "{\"value\": 1}\n\n  \t\n{\"value\": 2}\r\n\n", results));
+    ASSERT_EQ(results, std::vector<bool>({true, true}));
+
+    // NDJSON with a malformed line, not preventing the rest from being published
+    ASSERT_FALSE(enabler->publish_batch_json(topic_name, "{\"value\": 1}\n{\"value\": \n{\"value\": 3}", results));
+    ASSERT_EQ(results, std::vector<bool>({true, false, true}));
+}
+
+// Outcomes of asynchronous publications, in completion order
+struct AsyncCompletions
+{
+    // Completion callback of the sample with the given index
+    EnablerParticipant::PublishCompletion callback(
+            int index)
+    {
+        return [this, index](bool published)
+               {
+                   std::lock_guard<std::mutex> lock(mtx);
+                   outcomes.emplace_back(index, published);
+                   cv.notify_all();
+               };
+    }
+
+    // Wait until the given number of publications have completed
+    bool wait_for(
+            size_t completions)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        return cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return outcomes.size() >= completions;
+                       });
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        return outcomes.size();
+    }
+
+    std::vector<std::pair<int, bool>> outcomes;
+    std::mutex mtx;
+    std::condition_variable cv;
+};
+
+TEST_F(DDSEnablerTest, publish_async)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+
+    // Every sample is notified once, in publication order, with its own outcome
+    AsyncCompletions completions;
+    enabler->publish_async(get_topic_name(a_type), R"({"value": 0})", completions.callback(0));
+    enabler->publish_async(get_topic_name(a_type), R"({"value": 1})", completions.callback(1));
+    enabler->publish_async(get_topic_name(a_type), R"({"value": "not a number"})", completions.callback(2));
+    enabler->publish_async(get_topic_name(a_type), R"({"value": 3})", completions.callback(3));
+    enabler->publish_async("UnknownTopicName", R"({"value": 4})", completions.callback(4));
+
+    ASSERT_TRUE(completions.wait_for(5));
+
+    // Topics are resolved independently, so only the samples of the same topic keep their order
+    std::vector<std::pair<int, bool>> topic_outcomes;
+    for (const auto& outcome : completions.outcomes)
+    {
+        if (4 == outcome.first)
+        {
+            ASSERT_FALSE(outcome.second);
+        }
+        else
+        {
+            topic_outcomes.push_back(outcome);
+        }
+    }
+    ASSERT_EQ(topic_outcomes, (std::vector<std::pair<int, bool>>({{0, true}, {1, true}, {2, false}, {3, true}})));
+
+    // Samples without callback are published as well
+    enabler->publish_async(get_topic_name(a_type), R"({"value": 5})");
+    ASSERT_EQ(get_received_topic_queries(), 2);
+}
+
+TEST_F(DDSEnablerTest, publish_async_while_resolving)
+{
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+    set_topic_query_delay(500);
+
+    // Samples are queued while the topic is being resolved, without blocking
+    AsyncCompletions completions;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; i++)
+    {
+        enabler->publish_async(get_topic_name(a_type), R"({"value": )" + std::to_string(i) + "}",
+                completions.callback(i));
+    }
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+    ASSERT_EQ(completions.size(), 0u);
+
+    // And published in order once it is resolved
+    ASSERT_TRUE(completions.wait_for(3));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(500));
+    ASSERT_EQ(completions.outcomes, (std::vector<std::pair<int, bool>>({{0, true}, {1, true}, {2, true}})));
+    ASSERT_EQ(get_received_topic_queries(), 1);
+}
+
+TEST_F(DDSEnablerTest, publish_async_pending_on_destruction)
+{
+    auto enabler = create_ddsenabler_w_config(
+        R"(
+        ddsenabler:
+          initial-publish-wait: 10000
+          initial-publish-matched-readers: 1
+        )");
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+
+    // The topic waits for an external reader that never matches
+    AsyncCompletions completions;
+    for (int i = 0; i < 3; i++)
+    {
+        enabler->publish_async(get_topic_name(a_type), R"({"value": )" + std::to_string(i) + "}",
+                completions.callback(i));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(wait_after_publication_ms_));
+    ASSERT_EQ(completions.size(), 0u);
+
+    // Destroying the enabler interrupts the wait, failing the pending samples
+    const auto start = std::chrono::steady_clock::now();
+    enabler.reset();
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(5000));
+
+    ASSERT_EQ(completions.size(), 3u);
+    ASSERT_EQ(completions.outcomes, (std::vector<std::pair<int, bool>>({{0, false}, {1, false}, {2, false}})));
+}
+
+TEST_F(DDSEnablerTest, publish_declared_topic)
+{
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+    add_known_topic(a_type);
+
+    // The declared topic is resolved in the background at startup, waiting there for external readers
+    auto enabler = create_ddsenabler_w_config(
+        R"(
+        ddsenabler:
+          initial-publish-wait: 1000
+          initial-publish-matched-readers: 1
+          publish-topics: ["DDSEnablerTestType1TopicName"]
+        )");
+    ASSERT_TRUE(enabler != nullptr);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    ASSERT_EQ(get_received_topic_queries(), 1);
+    ASSERT_EQ(get_received_types(), 1);
+
+    // So the first publication neither queries the topic nor waits
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(enabler->publish(get_topic_name(a_type), R"({"value": 1})"));
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    ASSERT_EQ(get_received_topic_queries(), 1);
+    ASSERT_EQ(get_received_types(), 1);
+}
+
+TEST_F(DDSEnablerTest, delivery_statistics)
+{
+    ddsenablertester::num_samples_ = 3;
+
+    auto enabler = create_ddsenabler_w_config(
+        R"(
+        ddsenabler:
+          delivery-queue:
+            size: 10
+            policy: drop-oldest
+        )");
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+
+    // No statistics until samples of the topic are queued
+    DeliveryQueueStatistics statistics;
+    ASSERT_FALSE(enabler->get_delivery_statistics(get_topic_name(a_type), statistics));
+
+    ASSERT_TRUE(create_publisher(a_type));
+    ASSERT_TRUE(send_samples(a_type));
+    ASSERT_TRUE(wait_for_received_data(num_samples_));
+
+    ASSERT_TRUE(enabler->get_delivery_statistics(get_topic_name(a_type), statistics));
+    ASSERT_EQ(statistics.depth, 0u);
+    ASSERT_EQ(statistics.dropped, 0u);
+    ASSERT_EQ(statistics.coalesced, 0u);
+
+    // Without delivery queue there are no statistics
+    auto synchronous_enabler = create_ddsenabler();
+    ASSERT_TRUE(synchronous_enabler != nullptr);
+    ASSERT_FALSE(synchronous_enabler->get_delivery_statistics(get_topic_name(a_type), statistics));
+}
+
+TEST_F(DDSEnablerTest, delivery_statistics_coalesced)
+{
+    ddsenablertester::num_samples_ = 5;
+
+    // Samples arrive faster than they are notified, so they overwrite the pending one (all share the same instance)
+    data_notification_delay_ms_ = 200;
+
+    auto enabler = create_ddsenabler_w_config(
+        R"(
+        ddsenabler:
+          delivery-queue:
+            size: 10
+            policy: block
+            coalesced-topics: ["DDSEnablerTestType1TopicName"]
+        )");
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+
+    ASSERT_TRUE(create_publisher(a_type));
+    ASSERT_TRUE(send_samples(a_type));
+
+    // Every sample is either notified or coalesced
+    DeliveryQueueStatistics statistics;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_for_samples_ms_);
+    while (!enabler->get_delivery_statistics(get_topic_name(a_type), statistics) ||
+            get_received_data() + static_cast<int>(statistics.coalesced) < num_samples_)
+    {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_GT(statistics.coalesced, 0u);
+    ASSERT_EQ(statistics.dropped, 0u);
+    ASSERT_EQ(get_received_data() + static_cast<int>(statistics.coalesced), num_samples_);
+}
+
+TEST_F(DDSEnablerTest, dynamic_data_statistics)
+{
+    ddsenablertester::num_samples_ = 3;
+
+    auto enabler = create_ddsenabler();
+    ASSERT_TRUE(enabler != nullptr);
+
+    KnownType a_type;
+    a_type.type_sup_.reset(new DDSEnablerTestType1PubSubType());
+
+    // No statistics for unknown types
+    DynamicDataPoolStatistics statistics;
+    ASSERT_FALSE(enabler->get_dynamic_data_statistics(a_type.type_sup_.get_type_name(), statistics));
+
+    ASSERT_TRUE(create_publisher(a_type));
+    ASSERT_TRUE(send_samples(a_type));
+    ASSERT_TRUE(wait_for_received_data(num_samples_));
+
+    // DynamicData objects are only allocated when the pool has none to reuse
+    ASSERT_TRUE(enabler->get_dynamic_data_statistics(a_type.type_sup_.get_type_name(), statistics));
+    ASSERT_LE(statistics.allocated, statistics.acquired);
+    ASSERT_LE(statistics.pooled, statistics.allocated);
+}
+
 int main(
         int argc,
         char** argv)
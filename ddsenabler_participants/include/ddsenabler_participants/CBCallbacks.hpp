@@ -47,7 +47,8 @@ typedef void (* DdsLogFunc)(
  *
  * @param [in] type_name Name of the received type
  * @param [in] serialized_type Serialized type in IDL format
- * @param [in] serialized_type_internal Serialized type in internal format
+ * @param [in] serialized_type_internal Serialized type in internal format (serialized \c DynamicTypesCollection, or
+ * type bundle if so configured)
  * @param [in] serialized_type_internal_size Size of the serialized type in internal format
  * @param [in] data_placeholder JSON data placeholder
  */
@@ -82,11 +83,63 @@ typedef void (* DdsDataNotification)(
         const char* json,
         int64_t publish_time);
 
+/**
+ * DdsDataRecord - data sample delivered within a batch
+ */
+struct DdsDataRecord
+{
+    //! Name of the topic from which the data was received
+    const char* topic_name;
+
+    //! JSON representation of the data (null terminated)
+    const char* json;
+
+    //! Length of the JSON representation (excluding the null terminator)
+    uint32_t json_size;
+
+    //! Time (nanoseconds since epoch) when the data was published
+    int64_t publish_time;
+};
+
+/**
+ * DdsDataBatchNotification - callback for notifying the reception of several DDS data at once
+ *
+ * @param [in] records Data received, in reception order (only valid during the call)
+ * @param [in] records_count Number of records
+ */
+typedef void (* DdsDataBatchNotification)(
+        const DdsDataRecord* records,
+        uint32_t records_count);
+
+/**
+ * DdsDataRawNotification - callback for notifying the reception of DDS data in its serialized form, without any
+ * conversion
+ *
+ * @param [in] topic_name Name of the topic from which the data was received
+ * @param [in] type_name Name of the type of the data
+ * @param [in] serialized_data Serialized data, starting with its encapsulation header (only valid during the call)
+ * @param [in] serialized_data_size Size of the serialized data
+ * @param [in] encapsulation Encapsulation (data representation and endianness) of the serialized data
+ * @param [in] instance_handle Instance handle of the data (16 bytes)
+ * @param [in] source_guid GUID of the writer that published the data (16 bytes)
+ * @param [in] publish_time Time (nanoseconds since epoch) when the data was published
+ */
+typedef void (* DdsDataRawNotification)(
+        const char* topic_name,
+        const char* type_name,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation,
+        const unsigned char* instance_handle,
+        const unsigned char* source_guid,
+        int64_t publish_time);
+
 /**
  * DdsTypeQuery - callback for requesting information (serialized description and size) of a DDS type
  *
  * @param [in] type_name Name of the type to query
- * @param [out] serialized_type_internal Pointer to the serialized type in internal format
+ * @param [out] serialized_type_internal Pointer to the serialized type in internal format (serialized
+ * \c DynamicTypesCollection or type bundle, as notified)
  * @param [out] serialized_type_internal_size Size of the serialized type in internal format
  * @return \c true if the type was found and the information was retrieved successfully, \c false otherwise
  */
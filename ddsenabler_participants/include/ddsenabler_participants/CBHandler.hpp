@@ -18,10 +18,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <map>
+#include <set>
+#include <string>
 #include <utility>
 
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
@@ -35,6 +40,10 @@
 #include <ddsenabler_participants/CBHandlerConfiguration.hpp>
 #include <ddsenabler_participants/CBMessage.hpp>
 #include <ddsenabler_participants/CBWriter.hpp>
+#include <ddsenabler_participants/DeliveryQueue.hpp>
+#include <ddsenabler_participants/SchemaNotifier.hpp>
+#include <ddsenabler_participants/SchemaRegistry.hpp>
+#include <ddsenabler_participants/TypeStore.hpp>
 #include <ddsenabler_participants/library/library_dll.h>
 
 namespace std {
@@ -61,6 +70,10 @@ namespace participants {
 /**
  * Class that manages the interaction between \c EnablerParticipant and CB.
  * Payloads are efficiently passed from DDS Pipe to CB without copying data (only references).
+ * Samples of different topics are converted and notified concurrently, while samples of the same topic are notified
+ * one at a time and in reception order. If a delivery queue is configured, samples are notified by its own threads
+ * instead of the reception ones. Likewise, new schemas may be notified in the background, in which case the topics and
+ * samples of a type wait for the notification of its schema.
  *
  * @implements ISchemaHandler
  */
@@ -103,6 +116,8 @@ public:
      * @brief Add a topic, associated to the given \c topic.
      *
      * @param [in] topic DDS topic to be added.
+     * @note May block until the schema of the topic type is notified, so it must not be called holding locks the
+     * schema notification depends on.
      */
     DDSENABLER_PARTICIPANTS_DllAPI
     void add_topic(
@@ -122,6 +137,10 @@ public:
     /**
      * @brief Get the TypeIdentifier associated to the given type name.
      *
+     * If the type is unknown, it is resolved from the type registry or through the type query callback, without
+     * blocking the handling of other types. Concurrent requests of the same type share a single resolution, and types
+     * the user fails to provide are not queried again until the configured time has elapsed.
+     *
      * @param [in] type_name Name of the type to be retrieved.
      * @param [out] type_identifier TypeIdentifier of the type.
      * @return \c true if the type was found, \c false otherwise.
@@ -145,6 +164,59 @@ public:
             const std::string& json,
             ddspipe::core::types::Payload& payload);
 
+    /**
+     * @brief Get the serialized data (payload) of a sample of the type handled by the given codec from a JSON string.
+     *
+     * @param [in] codec Codec of the type of the data to be serialized.
+     * @param [in] json JSON string containing the data to be serialized.
+     * @param [out] payload Payload reference where the serialized data will be stored, reserved from the payload pool
+     * of the handler (and not reserved if serialization fails).
+     * @param [in] data_representation Representation to be used.
+     * @return \c true if the data was successfully serialized, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool get_serialized_data(
+            const TypeCodec& codec,
+            const std::string& json,
+            ddspipe::core::types::Payload& payload,
+            fastdds::dds::DataRepresentationId_t data_representation = fastdds::dds::XCDR_DATA_REPRESENTATION);
+
+    /**
+     * @brief Get the codec of the given type.
+     *
+     * @param [in] type_name Name of the type.
+     * @param [out] codec Codec of the type.
+     * @return \c true if the type was found, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool get_type_codec(
+            const std::string& type_name,
+            std::shared_ptr<const TypeCodec>& codec) const;
+
+    /**
+     * @brief Get the usage counters of the DynamicData pool of the given type.
+     *
+     * @param [in] type_name Name of the type.
+     * @param [out] statistics Usage counters of the pool.
+     * @return \c true if the type was found, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool get_dynamic_data_statistics(
+            const std::string& type_name,
+            DynamicDataPoolStatistics& statistics) const;
+
+    /**
+     * @brief Get the usage counters of the delivery queue of the given topic.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [out] statistics Usage counters of the queue.
+     * @return \c true if samples of the topic have been queued, \c false otherwise (or if no queue is configured).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool get_delivery_statistics(
+            const std::string& topic_name,
+            DeliveryQueueStatistics& statistics) const;
+
     /**
      * @brief Set the data notification callback.
      *
@@ -157,6 +229,34 @@ public:
         cb_writer_->set_data_notification_callback(callback);
     }
 
+    /**
+     * @brief Set the raw (serialized) data notification callback.
+     *
+     * @param [in] callback Callback to be set.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_data_raw_notification_callback(
+            participants::DdsDataRawNotification callback)
+    {
+        cb_writer_->set_data_raw_notification_callback(callback);
+    }
+
+    /**
+     * @brief Set the batched data notification callback, batching samples as configured.
+     *
+     * @param [in] callback Callback to be set.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_data_batch_notification_callback(
+            participants::DdsDataBatchNotification callback)
+    {
+        cb_writer_->set_data_batch_notification_callback(
+            callback,
+            configuration_.data_batch_max_samples,
+            configuration_.data_batch_max_bytes,
+            std::chrono::milliseconds(configuration_.data_batch_max_latency));
+    }
+
     /**
      * @brief Set the topic notification callback.
      *
@@ -221,7 +321,7 @@ protected:
             bool write_schema = true);
 
     /**
-     * @brief Write the schema to CB.
+     * @brief Write the schema to CB (or queue it, if schemas are notified in the background).
      *
      * @param [in] dyn_type DynamicType containing the type information required to generate the schema.
      * @param [in] type_id TypeIdentifier of the type.
@@ -241,12 +341,46 @@ protected:
     /**
      * @brief Write to CB.
      *
-     * @param [in] msg CBMessage to be added
-     * @param [in] dyn_type DynamicType containing the type information required.
+     * @param [in] msg CBMessage to be added (along with the codec of its type)
      */
     void write_sample_nts_(
-            const CBMessage& msg,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+            const CBMessage& msg);
+
+    /**
+     * @brief Fill a message with a received sample, referencing (not copying) its payload.
+     *
+     * @param [in] topic DDS topic associated to the sample.
+     * @param [in] data Sample received.
+     * @param [in] schema Schema of the topic type.
+     * @param [out] msg Message to be filled.
+     * @throw utils::InconsistencyException if the sample has no payload or payload owner.
+     */
+    void fill_message_(
+            const ddspipe::core::types::DdsTopic& topic,
+            ddspipe::core::types::RtpsPayloadData& data,
+            const SchemaRegistry::Schema& schema,
+            CBMessage& msg);
+
+    /**
+     * @brief Get the mutex serializing the samples of the given topic.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @note If the mutex is not already created, it will be created and stored in the map.
+     */
+    std::shared_ptr<std::mutex> get_topic_mutex_(
+            const std::string& topic_name);
+
+    /**
+     * @brief Resolve a type not registered yet, from the type registry or through the type query callback.
+     *
+     * @param [in] type_name Name of the type to be resolved.
+     * @param [out] type_identifier TypeIdentifier of the type.
+     * @return \c true if the type was resolved, \c false otherwise.
+     * @note Must be called without holding the mutex, which is only taken to register the type.
+     */
+    bool resolve_type_(
+            const std::string& type_name,
+            fastdds::dds::xtypes::TypeIdentifier& type_identifier);
 
     /**
      * @brief Register a type using the given serialized type data.
@@ -265,6 +399,9 @@ protected:
             fastdds::dds::xtypes::TypeIdentifier& type_identifier,
             fastdds::dds::xtypes::TypeObject& type_object);
 
+    //! Register all the types persisted in the type store and add their schemas, so they are ready without queries
+    void load_type_store_nts_();
+
     //! Handler configuration
     CBHandlerConfiguration configuration_;
 
@@ -274,18 +411,44 @@ protected:
     //! CB writer
     std::unique_ptr<CBWriter> cb_writer_;
 
-    //! Schemas map
-    std::map<std::string,
-            std::pair<fastdds::dds::xtypes::TypeIdentifier, fastdds::dds::DynamicType::_ref_type>> schemas_;
+    //! Schemas registry (looked up without locking)
+    SchemaRegistry schemas_;
 
     //! Unique sequence number assigned to received messages. It is incremented with every sample added
-    unsigned int unique_sequence_number_{0};
+    std::atomic<unsigned int> unique_sequence_number_{0};
 
-    //! Mutex synchronizing access to object's data structures
+    //! Mutex synchronizing schema registration and schema/topic notifications
     std::mutex mtx_;
 
+    //! Mutexes serializing the conversion and notification of the samples of each topic
+    std::map<std::string, std::shared_ptr<std::mutex>> topic_mutexes_;
+
+    //! Mutex synchronizing access to \c topic_mutexes_
+    std::mutex topic_mutexes_mtx_;
+
     //! Callback to request types from the user
     DdsTypeQuery type_query_callback_;
+
+    //! Types being resolved
+    std::set<std::string> resolving_types_;
+
+    //! Types the user failed to provide, along with the time until which they are not queried again
+    std::map<std::string, std::chrono::steady_clock::time_point> unknown_types_;
+
+    //! Mutex synchronizing access to \c resolving_types_ and \c unknown_types_
+    std::mutex resolution_mtx_;
+
+    //! Notified when a type resolution finishes
+    std::condition_variable resolution_cv_;
+
+    //! Store persisting the known types (only created if configured)
+    std::shared_ptr<TypeStore> type_store_;
+
+    //! Queue of samples pending delivery (only created if configured)
+    std::unique_ptr<DeliveryQueue> delivery_queue_;
+
+    //! Background stage notifying new schemas (only created if configured)
+    std::unique_ptr<SchemaNotifier> schema_notifier_;
 };
 
 } /* namespace participants */
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <cstdint>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -26,6 +27,36 @@ namespace eprosima {
 namespace ddsenabler {
 namespace participants {
 
+/**
+ * Behaviour of a delivery queue when a sample arrives and the queue of its topic is full.
+ */
+enum class DeliveryPolicy
+{
+    //! Wait (in the reception thread) until there is room in the queue
+    BLOCK,
+
+    //! Discard the oldest pending sample
+    DROP_OLDEST,
+
+    //! Discard the incoming sample
+    DROP_NEWEST,
+
+    //! Replace the pending sample of the same instance, or discard the oldest one if there is none
+    KEEP_LAST_PER_INSTANCE
+};
+
+/**
+ * Format of the serialized types handed to the type notification callback (and persisted in the type store).
+ */
+enum class TypeFormat
+{
+    //! Serialized \c DynamicTypesCollection
+    DYNAMIC_TYPES_COLLECTION,
+
+    //! Type bundle (see \c serialization::serialize_type_bundle )
+    TYPE_BUNDLE
+};
+
 /**
  * Structure encapsulating all of \c CBHandler configuration options.
  */
@@ -35,6 +66,41 @@ struct CBHandlerConfiguration
     {
     }
 
+    //! Maximum number of DynamicData objects kept for reuse per type (0 disables pooling)
+    unsigned int dynamic_data_pool_size {8u};
+
+    //! Maximum number of samples delivered in a batched data notification
+    unsigned int data_batch_max_samples {64u};
+
+    //! Maximum size (in bytes) of the samples delivered in a batched data notification
+    unsigned int data_batch_max_bytes {1u << 20};
+
+    //! Maximum time (in milliseconds) a sample waits before being delivered in a batched data notification
+    unsigned int data_batch_max_latency {10u};
+
+    //! Maximum number of samples pending delivery per topic (0 notifies samples synchronously in the reception thread)
+    unsigned int delivery_queue_size {0u};
+
+    //! Behaviour when the delivery queue of a topic is full
+    DeliveryPolicy delivery_policy {DeliveryPolicy::BLOCK};
+
+    //! Number of threads notifying queued samples
+    unsigned int delivery_threads {1u};
+
+    //! Topics (wildcards allowed) whose pending samples are overwritten by newer ones of the same instance
+    std::set<std::string> coalesced_topics;
+
+    //! Number of threads notifying new schemas in the background (0 notifies them synchronously on registration)
+    unsigned int schema_notification_threads {0u};
+
+    //! Time (in milliseconds) a type the user failed to provide is not queried again (0 queries it on every request)
+    unsigned int unknown_type_ttl {0u};
+
+    //! File where the known types are persisted and registered from at startup (empty disables the type store)
+    std::string type_store_path;
+
+    //! Format of the serialized types notified to the user
+    TypeFormat type_format {TypeFormat::DYNAMIC_TYPES_COLLECTION};
 };
 
 } /* namespace participants */
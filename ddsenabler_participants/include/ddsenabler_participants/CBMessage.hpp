@@ -29,6 +29,8 @@ namespace eprosima {
 namespace ddsenabler {
 namespace participants {
 
+class TypeCodec;
+
 /**
  * Structure with Fast DDS payload and its owner (a \c PayloadPool).
  */
@@ -82,6 +84,9 @@ struct CBMessage
 
     //! Unique sequence number assigned to received messages.
     unsigned int sequence_number;
+
+    //! Codec of the message type (owned by the handler's schemas registry, which outlives the message)
+    const TypeCodec* codec{nullptr};
 };
 
 } /* namespace participants */
@@ -18,16 +18,26 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
-#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/InstanceHandle.hpp>
 
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 #include <ddsenabler_participants/CBCallbacks.hpp>
+#include <ddsenabler_participants/CBHandlerConfiguration.hpp>
 #include <ddsenabler_participants/CBMessage.hpp>
+#include <ddsenabler_participants/DataBatcher.hpp>
+#include <ddsenabler_participants/TypeCodec.hpp>
+#include <ddsenabler_participants/TypeStore.hpp>
 
 namespace eprosima {
 namespace ddsenabler {
@@ -36,7 +46,8 @@ namespace participants {
 /**
  * @brief Helper class encapsulating the logic to write data, topics and schemas to the CB.
  *
- * @warning This class is not thread-safe.
+ * @warning Data and schemas can be written concurrently from different threads (e.g. one per topic), but topics must
+ * not be written concurrently.
  */
 class CBWriter
 {
@@ -56,6 +67,36 @@ public:
         data_notification_callback_ = callback;
     }
 
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_data_raw_notification_callback(
+            DdsDataRawNotification callback)
+    {
+        data_raw_notification_callback_ = callback;
+    }
+
+    /**
+     * @brief Set the batched data notification callback.
+     *
+     * @param [in] callback Callback to be set (\c nullptr disables batched notifications).
+     * @param [in] max_samples Maximum number of samples in a batch.
+     * @param [in] max_bytes Maximum size of the texts in a batch.
+     * @param [in] max_latency Maximum time a sample waits before its batch is delivered.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_data_batch_notification_callback(
+            DdsDataBatchNotification callback,
+            uint32_t max_samples,
+            uint32_t max_bytes,
+            std::chrono::milliseconds max_latency)
+    {
+        // Deliver the samples batched so far before replacing the batcher
+        data_batcher_.reset();
+        if (callback)
+        {
+            data_batcher_ = std::make_unique<DataBatcher>(max_samples, max_bytes, max_latency, callback);
+        }
+    }
+
     DDSENABLER_PARTICIPANTS_DllAPI
     void set_type_notification_callback(
             DdsTypeNotification callback)
@@ -63,6 +104,22 @@ public:
         type_notification_callback_ = callback;
     }
 
+    //! Set the store where the written schemas are persisted (may be \c nullptr )
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_type_store(
+            std::shared_ptr<TypeStore> type_store)
+    {
+        type_store_ = std::move(type_store);
+    }
+
+    //! Set the format of the serialized types notified (and persisted)
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void set_type_format(
+            TypeFormat type_format)
+    {
+        type_format_ = type_format;
+    }
+
     DDSENABLER_PARTICIPANTS_DllAPI
     void set_topic_notification_callback(
             DdsTopicNotification callback)
@@ -73,6 +130,10 @@ public:
     /**
      * @brief Writes the schema of a DynamicType to CB.
      *
+     * The schema is generated eagerly on every call, as the type notification callback receives it complete: its
+     * serialized types whenever the type notification callback or the type store is set, and its IDL and data
+     * placeholder only if the type notification callback is set. Nothing is cached, as each schema is written once.
+     *
      * @param [in] dyn_type DynamicType containing the type information required.
      * @param [in] type_id TypeIdentifier of the DynamicType.
      */
@@ -93,43 +154,141 @@ public:
     /**
      * @brief Writes data.
      *
-     * @param [in] msg Pointer to the data to be written.
-     * @param [in] dyn_type DynamicType containing the type information required.
+     * @param [in] msg Pointer to the data to be written (its codec must be set).
      */
     DDSENABLER_PARTICIPANTS_DllAPI
     void write_data(
-            const CBMessage& msg,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+            const CBMessage& msg);
+
+    /**
+     * @brief Writes data in its serialized form.
+     *
+     * @param [in] msg Pointer to the data to be written.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void write_raw_data(
+            const CBMessage& msg);
 
 protected:
 
+    //! Top level entries of the data notification
+    enum class EnvelopeEntry
+    {
+        ID,
+        TYPE,
+        TOPIC
+    };
+
+    //! Pre-formatted parts of the data notification of a topic
+    struct TopicEnvelope
+    {
+        //! Type name the envelope was built for
+        std::string type_name;
+
+        //! Top level entries, in the order they are written
+        std::vector<EnvelopeEntry> entries;
+
+        //! Text preceding the instance handle
+        std::string opening;
+
+        //! Text following the sample
+        std::string closing;
+    };
+
+    //! Per thread buffers used to build data notifications
+    struct DataOutput
+    {
+        //! Buffer where data notifications are built, reused across samples
+        std::string buffer;
+
+        //! Last formatted guid prefix
+        fastdds::rtps::GuidPrefix_t guid_prefix;
+        std::string guid_prefix_string;
+
+        //! Last formatted instance handle
+        fastdds::rtps::InstanceHandle_t instance_handle;
+        std::string instance_handle_string;
+    };
+
+    //! Top level keys of the data notification
+    static constexpr const char* ENVELOPE_ID_KEY = "id";
+    static constexpr const char* ENVELOPE_TYPE_KEY = "type";
+
+    //! Indentation level of the samples within the data notification
+    static constexpr uint32_t SAMPLE_INDENTATION_LEVEL = 3;
+
     /**
-     * @brief Returns the dyn_data of a dyn_type.
+     * @brief Serializes a type and its dependencies in the configured format.
+     *
+     * @param [in] type_name Name of the type.
+     * @param [in] type_id TypeIdentifier of the type.
+     * @param [out] serialized_types Serialized types.
+     * @return true if the types were serialized, false otherwise.
+     */
+    bool serialize_types_(
+            const std::string& type_name,
+            const fastdds::dds::xtypes::TypeIdentifier& type_id,
+            std::vector<unsigned char>& serialized_types) const;
+
+    /**
+     * @brief Writes the JSON representation of a sample.
      *
      * @param [in] msg Pointer to the data.
-     * @param [in] dyn_type DynamicType containing the type information required.
+     * @param [in,out] output String where the sample is appended.
+     * @return true if the sample was written, false otherwise.
      */
-    fastdds::dds::DynamicData::_ref_type get_dynamic_data_(
+    bool write_sample_(
             const CBMessage& msg,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept;
+            std::string& output);
 
     /**
-     * @brief Returns the pubsub type of a dyn_type.
+     * @brief Returns the pre-formatted parts of the data notification of a topic.
      *
-     * @param [in] dyn_type DynamicType from which to get the pubsub type.
-     * @return The pubsub type associated to the given dyn_type.
-     * @note If the pubsub type is not already created, it will be created and stored in the map.
+     * @param [in] topic_name Topic of the data notification.
+     * @param [in] codec Codec of the topic type.
+     * @note If the envelope is not already created, it will be created and stored in the map.
+     */
+    std::shared_ptr<const TopicEnvelope> get_topic_envelope_(
+            const std::string& topic_name,
+            const TypeCodec& codec);
+
+    /**
+     * @brief Returns a guid prefix formatted as a JSON string.
+     */
+    static const std::string& get_guid_prefix_string_(
+            DataOutput& data_output,
+            const fastdds::rtps::GuidPrefix_t& guid_prefix);
+
+    /**
+     * @brief Returns an instance handle formatted as a JSON string.
      */
-    fastdds::dds::DynamicPubSubType get_pubsub_type_(
-            const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept;
+    static const std::string& get_instance_handle_string_(
+            DataOutput& data_output,
+            const fastdds::rtps::InstanceHandle_t& instance_handle);
 
     // Callbacks to notify the CB
     DdsDataNotification data_notification_callback_;
+    DdsDataRawNotification data_raw_notification_callback_;
     DdsTypeNotification type_notification_callback_;
     DdsTopicNotification topic_notification_callback_;
 
-    // Map to store the pubsub types associated to dynamic types so they can be reused
-    std::map<fastdds::dds::DynamicType::_ref_type, fastdds::dds::DynamicPubSubType> dynamic_pubsub_types_;
+    // Store where the written schemas are persisted (only set if configured)
+    std::shared_ptr<TypeStore> type_store_;
+
+    // Format of the serialized types notified and persisted
+    TypeFormat type_format_ {TypeFormat::DYNAMIC_TYPES_COLLECTION};
+
+    // Batcher of data notifications (only created if a batched data notification callback is set)
+    std::unique_ptr<DataBatcher> data_batcher_;
+
+    // Map to store the data notification envelopes associated to topic names so they can be reused
+    std::map<std::string, std::shared_ptr<const TopicEnvelope>> topic_envelopes_;
+
+    // Mutex synchronizing access to the envelopes map
+    std::mutex data_mtx_;
+
+    // Mutex serializing type notifications
+    std::mutex schema_mtx_;
 };
 
 } /* namespace participants */
@@ -0,0 +1,308 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CdrJsonTranscoder.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} /* namespace fastcdr */
+
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Transcodes CDR serialized samples into JSON (EPROSIMA format) without materializing a \c DynamicData.
+ *
+ * A walk plan is computed once from the \c DynamicType of the samples, and then reused for every payload of that
+ * type: members are read with Fast CDR and written as JSON text as they are decoded. The resulting text is identical
+ * to the one obtained by deserializing the payload into a \c DynamicData , serializing it with \c json_serialize
+ * and dumping it with \c nlohmann::json (4 spaces indentation, sorted keys).
+ *
+ * @note Payloads that cannot be transcoded are reported through the return value, so the caller can fall back to
+ * the \c DynamicData path.
+ */
+class CdrJsonTranscoder
+{
+public:
+
+    /**
+     * @brief Build a transcoder for the given type.
+     *
+     * The walk plan is validated against \c json_serialize with a default constructed sample (both in XCDR1 and
+     * XCDR2), so types whose JSON representation cannot be reproduced are rejected.
+     *
+     * @param [in] dyn_type DynamicType of the samples to be transcoded.
+     * @return The transcoder, or \c nullptr if the type is not supported.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    static std::unique_ptr<CdrJsonTranscoder> create(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+
+    /**
+     * @brief Transcode a serialized sample into JSON.
+     *
+     * @param [in] payload Serialized sample (including its encapsulation header).
+     * @param [in,out] output String where the JSON text is appended.
+     * @param [in] indent_level Indentation level at which the JSON object is nested.
+     * @return \c true if the sample was transcoded, \c false otherwise (\c output is left unmodified).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool transcode(
+            const fastdds::rtps::SerializedPayload_t& payload,
+            std::string& output,
+            uint32_t indent_level = 0) const;
+
+protected:
+
+    //! Kind of a node in the walk plan (aliases are resolved when building it)
+    enum class NodeKind : uint8_t
+    {
+        BOOLEAN,
+        BYTE,
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT32,
+        FLOAT64,
+        FLOAT128,
+        CHAR8,
+        CHAR16,
+        STRING8,
+        STRING16,
+        ENUM,
+        BITMASK,
+        BITSET,
+        STRUCTURE,
+        UNION,
+        SEQUENCE,
+        ARRAY,
+        MAP
+    };
+
+    //! Member of a structure, union or bitset
+    struct Member
+    {
+        //! Member name
+        std::string name;
+
+        //! Pre-formatted JSON key (i.e. "name": )
+        std::string key;
+
+        //! Member id
+        uint32_t id {0};
+
+        //! Index of the member type in the plan
+        uint32_t node {0};
+
+        //! Position of the member in the JSON object (keys are sorted)
+        uint32_t rank {0};
+
+        //! Whether the member is optional
+        bool optional {false};
+
+        //! Union labels
+        std::vector<int32_t> labels;
+
+        //! Whether the member is the default union member
+        bool default_label {false};
+
+        //! Bitset bitfield position and size
+        uint32_t position {0};
+        uint32_t bitcount {0};
+
+        //! Whether the member appears in a default constructed sample, and its JSON text at level 0
+        bool default_present {false};
+        std::string default_json;
+    };
+
+    //! Node of the walk plan
+    struct Node
+    {
+        NodeKind kind {NodeKind::STRUCTURE};
+
+        //! Extensibility of structures and unions
+        fastdds::dds::ExtensibilityKind extensibility {fastdds::dds::ExtensibilityKind::FINAL};
+
+        //! Members of structures, unions and bitsets, in serialization order
+        std::vector<Member> members;
+
+        //! Member index by member id (used with parameter list encodings)
+        std::unordered_map<uint32_t, uint32_t> members_by_id;
+
+        //! Whether the default values of the members are known
+        bool calibrated {false};
+
+        //! JSON text used when no element/member is written (e.g. empty sequences)
+        std::string empty_json;
+
+        //! Union discriminator type
+        uint32_t discriminator {0};
+
+        //! Enumeration and bitmask bit bound, and bitset holder size (in bits)
+        uint32_t bit_bound {32};
+
+        //! Underlying type of enumerations
+        NodeKind literal_kind {NodeKind::INT32};
+
+        //! Enumerator name (already formatted as a JSON string) by value
+        std::map<int64_t, std::string> enumerators;
+
+        //! Bitmask flags (position, name formatted as a JSON string)
+        std::vector<std::pair<uint32_t, std::string>> flags;
+
+        //! Collection element and map key types
+        uint32_t element {0};
+        uint32_t key {0};
+
+        //! Array dimensions
+        std::vector<uint32_t> dimensions;
+
+        //! Whether the collection elements are serialized without DHEADER in XCDR2
+        bool primitive_element {false};
+    };
+
+    struct Context;
+    struct StructFrame;
+    struct UnionFrame;
+
+    CdrJsonTranscoder() = default;
+
+    //! Build the plan node of a type, returning its index
+    uint32_t build_node_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            std::map<fastdds::dds::DynamicType*, uint32_t>& visited);
+
+    //! Find out the default JSON text of the members of a structure
+    void calibrate_structure_(
+            uint32_t node_index,
+            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+
+    //! Check the plan reproduces \c json_serialize output for a default constructed sample
+    bool validate_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type) const;
+
+    void decode_value_(
+            fastcdr::Cdr& cdr,
+            uint32_t node_index,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_structure_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    bool decode_structure_member_(
+            fastcdr::Cdr& cdr,
+            uint32_t member_id,
+            StructFrame& frame) const;
+
+    void decode_union_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    bool decode_union_member_(
+            fastcdr::Cdr& cdr,
+            uint32_t member_id,
+            UnionFrame& frame) const;
+
+    void decode_bitset_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_enum_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_bitmask_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_sequence_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_array_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_array_dimension_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            size_t dimension,
+            uint32_t level,
+            Context& ctx) const;
+
+    void decode_map_(
+            fastcdr::Cdr& cdr,
+            const Node& node,
+            uint32_t level,
+            Context& ctx) const;
+
+    //! Read an integral value (enumerations and bitmasks included) as a signed 64 bits integer
+    int64_t read_integral_(
+            fastcdr::Cdr& cdr,
+            const Node& node) const;
+
+    //! Write the key/value pairs of an object, sorted and without duplicated keys
+    void close_object_(
+            const Node& node,
+            size_t begin,
+            size_t fragments_base,
+            bool keyed_by_name,
+            uint32_t level,
+            Context& ctx) const;
+
+    //! Walk plan, the root structure being the first node
+    std::vector<Node> nodes_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,166 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataBatcher.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddsenabler_participants/CBCallbacks.hpp>
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Accumulates data notifications and delivers them in batches through a \c DdsDataBatchNotification callback.
+ *
+ * A batch is delivered when it reaches a maximum number of samples or bytes, or when its oldest sample has waited for
+ * a maximum latency. The topic names and JSON texts of a batch are stored in a single buffer (arena), which is reused
+ * once the callback returns, so no allocation is required per sample in steady state.
+ *
+ * @note Samples can be added concurrently. Batches are delivered one at a time and in the order samples were added.
+ */
+class DataBatcher
+{
+public:
+
+    /**
+     * @brief Create a batcher and start its latency timer.
+     *
+     * @param [in] max_samples Maximum number of samples in a batch.
+     * @param [in] max_bytes Maximum size (topic names and JSON texts) of a batch.
+     * @param [in] max_latency Maximum time a sample waits before its batch is delivered.
+     * @param [in] callback Callback batches are delivered to.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    DataBatcher(
+            uint32_t max_samples,
+            uint32_t max_bytes,
+            std::chrono::milliseconds max_latency,
+            DdsDataBatchNotification callback);
+
+    /**
+     * @brief Stop the latency timer and deliver the pending samples.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    ~DataBatcher();
+
+    /**
+     * @brief Add a sample to the current batch, delivering the batch if full.
+     *
+     * @param [in] topic_name Topic the sample was received from.
+     * @param [in] json JSON representation of the sample.
+     * @param [in] json_size Length of the JSON representation.
+     * @param [in] publish_time Time (nanoseconds since epoch) when the sample was published.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void add(
+            const std::string& topic_name,
+            const char* json,
+            uint32_t json_size,
+            int64_t publish_time);
+
+    /**
+     * @brief Deliver the current batch, if not empty.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void flush();
+
+protected:
+
+    //! Sample within a batch, pointing into its arena by offset (the arena may grow while the batch is built)
+    struct Entry
+    {
+        size_t topic_name_offset;
+        size_t json_offset;
+        uint32_t json_size;
+        int64_t publish_time;
+    };
+
+    //! Samples pending delivery and the buffer holding their texts
+    struct Batch
+    {
+        std::vector<char> arena;
+        std::vector<Entry> entries;
+        std::vector<DdsDataRecord> records;
+        std::chrono::steady_clock::time_point deadline;
+
+        bool empty() const noexcept
+        {
+            return entries.empty();
+        }
+
+        void clear() noexcept
+        {
+            arena.clear();
+            entries.clear();
+            records.clear();
+        }
+
+    };
+
+    /**
+     * @brief Swap the current batch for the (empty) spare one and deliver it.
+     *
+     * @param [in,out] lock Lock on \c mtx_ , released during the delivery and acquired again afterwards.
+     * @pre \c flush_mtx_ is locked by the caller.
+     */
+    void deliver_nts_(
+            std::unique_lock<std::mutex>& lock);
+
+    //! Deliver batches whose oldest sample reached the maximum latency
+    void timer_routine_();
+
+    //! Batching limits
+    const uint32_t max_samples_;
+    const uint32_t max_bytes_;
+    const std::chrono::milliseconds max_latency_;
+
+    //! Callback batches are delivered to
+    const DdsDataBatchNotification callback_;
+
+    //! Batch being filled, and the one recycled after being delivered
+    Batch current_;
+    Batch spare_;
+
+    //! Mutex synchronizing access to the current batch
+    std::mutex mtx_;
+
+    //! Mutex serializing deliveries (always acquired before \c mtx_ )
+    std::mutex flush_mtx_;
+
+    //! Wakes the timer up when a batch starts or the batcher is destroyed
+    std::condition_variable cv_;
+
+    //! Whether the timer must stop
+    bool stop_ {false};
+
+    //! Latency timer
+    std::thread timer_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
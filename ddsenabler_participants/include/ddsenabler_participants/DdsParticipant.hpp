@@ -18,8 +18,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include <ddspipe_participants/participant/dynamic_types/DynTypesParticipant.hpp>
 
+#include <ddsenabler_participants/WriterMatchTracker.hpp>
 #include <ddsenabler_participants/library/library_dll.h>
 
 namespace eprosima {
@@ -34,11 +37,17 @@ public:
     DdsParticipant(
             std::shared_ptr<ddspipe::participants::SimpleParticipantConfiguration> participant_configuration,
             std::shared_ptr<ddspipe::core::PayloadPool> payload_pool,
-            std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database);
+            std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database,
+            std::shared_ptr<WriterMatchTracker> match_tracker = nullptr);
 
     DDSENABLER_PARTICIPANTS_DllAPI
     std::shared_ptr<ddspipe::core::IWriter> create_writer(
             const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    //! Tracker notified of the readers matched by the created writers (if any)
+    std::shared_ptr<WriterMatchTracker> match_tracker_;
 };
 
 } /* namespace participants */
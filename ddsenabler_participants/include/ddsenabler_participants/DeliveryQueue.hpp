@@ -0,0 +1,182 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryQueue.hpp
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddsenabler_participants/CBHandlerConfiguration.hpp>
+#include <ddsenabler_participants/CBMessage.hpp>
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Usage counters of the delivery queue of a topic.
+ */
+struct DeliveryQueueStatistics
+{
+    //! Number of samples pending delivery
+    uint64_t depth {0};
+
+    //! Number of samples discarded because the queue was full
+    uint64_t dropped {0};
+
+    //! Number of pending samples overwritten by a newer one of the same instance
+    uint64_t coalesced {0};
+};
+
+/**
+ * @brief Bounded per-topic queues decoupling the reception of samples from their notification.
+ *
+ * Samples are pushed by the reception threads and notified by a pool of delivery threads, so a slow consumer does not
+ * stall the reception of other topics. Samples of the same topic are notified one at a time and in reception order,
+ * while samples of different topics may be notified concurrently.
+ *
+ * Topics can be configured to be coalesced: a sample overwrites the pending (not yet notified) one of its instance, if
+ * any, so only the latest value of each instance is notified and the queue never holds more samples than instances.
+ */
+class DeliveryQueue
+{
+public:
+
+    //! Function notifying a sample
+    using DeliveryFunction = std::function<void (const CBMessage&)>;
+
+    /**
+     * @brief Create the queues and start the delivery threads.
+     *
+     * @param [in] size Maximum number of samples pending delivery per topic.
+     * @param [in] policy Behaviour when the queue of a topic is full.
+     * @param [in] n_threads Number of delivery threads.
+     * @param [in] deliver Function notifying a sample.
+     * @param [in] coalesced_topics Topics (wildcards allowed) whose samples are coalesced per instance.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    DeliveryQueue(
+            unsigned int size,
+            DeliveryPolicy policy,
+            unsigned int n_threads,
+            DeliveryFunction deliver,
+            const std::set<std::string>& coalesced_topics = {});
+
+    /**
+     * @brief Stop the delivery threads, discarding the samples pending delivery.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    ~DeliveryQueue();
+
+    /**
+     * @brief Queue a sample for delivery, applying the configured policy if the queue of its topic is full.
+     *
+     * @param [in] msg Sample to be delivered.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void push(
+            std::unique_ptr<CBMessage>&& msg);
+
+    /**
+     * @brief Get the usage counters of the queue of a topic.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [out] statistics Usage counters of the queue.
+     * @return \c true if the topic has received samples, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool get_statistics(
+            const std::string& topic_name,
+            DeliveryQueueStatistics& statistics) const;
+
+protected:
+
+    //! Samples of a topic pending delivery
+    struct TopicQueue
+    {
+        std::deque<std::unique_ptr<CBMessage>> samples;
+
+        //! Whether the queue is waiting for a delivery thread or being delivered by one
+        bool scheduled {false};
+
+        //! Whether samples are coalesced per instance
+        bool coalesced {false};
+
+        //! Pending sample of each instance (only filled if coalesced; deque elements do not move on push/pop)
+        std::map<ddspipe::core::types::InstanceHandle, std::unique_ptr<CBMessage>*> pending_instances;
+
+        uint64_t dropped {0};
+        uint64_t coalesced_samples {0};
+    };
+
+    //! Get the queue of a topic, creating it if it does not exist
+    TopicQueue& get_topic_queue_nts_(
+            const std::string& topic_name);
+
+    //! Take the oldest pending sample of a queue
+    static std::unique_ptr<CBMessage> pop_nts_(
+            TopicQueue& queue);
+
+    //! Notify queued samples until stopped
+    void delivery_routine_();
+
+    //! Queue limits
+    const unsigned int size_;
+    const DeliveryPolicy policy_;
+
+    //! Function notifying a sample
+    const DeliveryFunction deliver_;
+
+    //! Topics whose samples are coalesced per instance
+    const std::set<std::string> coalesced_topics_;
+
+    //! Queues of every topic (never removed, so pointers to them remain valid)
+    std::map<std::string, TopicQueue> topic_queues_;
+
+    //! Queues with samples and not being delivered, in the order they are to be served
+    std::deque<TopicQueue*> ready_queues_;
+
+    //! Mutex synchronizing access to the queues
+    mutable std::mutex mtx_;
+
+    //! Wakes up delivery threads when a queue becomes ready
+    std::condition_variable ready_cv_;
+
+    //! Wakes up blocked reception threads when a sample is taken from a queue
+    std::condition_variable space_cv_;
+
+    //! Whether the delivery threads must stop
+    bool stop_ {false};
+
+    //! Delivery threads
+    std::vector<std::thread> delivery_threads_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
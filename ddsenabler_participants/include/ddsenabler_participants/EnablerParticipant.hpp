@@ -18,15 +18,32 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
 #include <map>
 #include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 #include <ddspipe_participants/participant/dynamic_types/SchemaParticipant.hpp>
 #include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
 
 #include <ddsenabler_participants/CBCallbacks.hpp>
 #include <ddsenabler_participants/EnablerParticipantConfiguration.hpp>
+#include <ddsenabler_participants/PayloadLoan.hpp>
+#include <ddsenabler_participants/TopicHandle.hpp>
+#include <ddsenabler_participants/WriterMatchTracker.hpp>
 #include <ddsenabler_participants/library/library_dll.h>
 
 namespace eprosima {
@@ -37,22 +54,199 @@ class EnablerParticipant : public ddspipe::participants::SchemaParticipant
 {
 public:
 
+    //! Function notified of the outcome of an asynchronous publication
+    using PublishCompletion = std::function<void (bool published)>;
+
     DDSENABLER_PARTICIPANTS_DllAPI
     EnablerParticipant(
             std::shared_ptr<EnablerParticipantConfiguration> participant_configuration,
             std::shared_ptr<ddspipe::core::PayloadPool> payload_pool,
             std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database,
-            std::shared_ptr<ddspipe::participants::ISchemaHandler> schema_handler);
+            std::shared_ptr<ddspipe::participants::ISchemaHandler> schema_handler,
+            std::shared_ptr<WriterMatchTracker> match_tracker = nullptr,
+            std::shared_ptr<utils::SlotThreadPool> thread_pool = nullptr);
+
+    /**
+     * @brief Stop the ongoing asynchronous topic resolutions (interrupting their waits), failing their queued samples.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    ~EnablerParticipant();
 
     DDSENABLER_PARTICIPANTS_DllAPI
     std::shared_ptr<ddspipe::core::IReader> create_reader(
             const ddspipe::core::ITopic& topic) override;
 
+    /**
+     * @brief Resolve a topic to publish in, creating it through the topic query callback if unknown.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [out] handle Handle of the topic, to be used in subsequent publications.
+     * @return \c true if the topic was resolved, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool resolve_topic(
+            const std::string& topic_name,
+            TopicHandle& handle);
+
     DDSENABLER_PARTICIPANTS_DllAPI
     bool publish(
             const std::string& topic_name,
             const std::string& json);
 
+    /**
+     * @brief Publish a JSON sample in a resolved topic, without looking it up.
+     *
+     * @param [in] handle Handle of the topic, obtained with \c resolve_topic .
+     * @param [in] json JSON sample to be published.
+     * @return \c true if the sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish(
+            const TopicHandle& handle,
+            const std::string& json);
+
+    /**
+     * @brief Publish an already serialized sample, without any conversion.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] serialized_data Serialized sample, starting with its encapsulation header (copied).
+     * @param [in] serialized_data_size Size of the serialized sample.
+     * @param [in] encapsulation Encapsulation (data representation and endianness) of the serialized sample.
+     * @param [in] validate Whether to check the encapsulation header and the size of the sample before publishing it.
+     * @return \c true if the sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish_serialized(
+            const std::string& topic_name,
+            const unsigned char* serialized_data,
+            uint32_t serialized_data_size,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * @brief Publish an already serialized sample in a resolved topic, without any conversion.
+     *
+     * @param [in] handle Handle of the topic, obtained with \c resolve_topic .
+     * @param [in] serialized_data Serialized sample, starting with its encapsulation header (copied).
+     * @param [in] serialized_data_size Size of the serialized sample.
+     * @param [in] encapsulation Encapsulation (data representation and endianness) of the serialized sample.
+     * @param [in] validate Whether to check the encapsulation header and the size of the sample before publishing it.
+     * @return \c true if the sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish_serialized(
+            const TopicHandle& handle,
+            const unsigned char* serialized_data,
+            uint32_t serialized_data_size,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * @brief Loan a payload of the payload pool, so a sample can be serialized straight into it.
+     *
+     * @param [in] handle Handle of the topic, obtained with \c resolve_topic .
+     * @param [in] size Size of the serialized sample, including its encapsulation header.
+     * @param [out] loan Loan holding the payload.
+     * @return \c true if the payload was loaned, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool loan_payload(
+            const TopicHandle& handle,
+            uint32_t size,
+            PayloadLoan& loan);
+
+    /**
+     * @brief Publish the sample serialized in a loaned payload, without copying it.
+     *
+     * The loan is consumed if the sample is published, and kept otherwise.
+     *
+     * @param [in,out] loan Loan holding the serialized sample, obtained with \c loan_payload .
+     * @param [in] encapsulation Encapsulation (data representation and endianness) of the serialized sample.
+     * @param [in] validate Whether to check the encapsulation header and the size of the sample before publishing it.
+     * @return \c true if the sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool commit_payload(
+            PayloadLoan& loan,
+            uint16_t encapsulation,
+            bool validate = true);
+
+    /**
+     * @brief Publish a JSON sample without blocking on the resolution of its topic.
+     *
+     * If the topic is ready, the sample is published right away. Otherwise the sample is queued and the topic is
+     * resolved (i.e. created through the topic query callback) in the background, then publishing its queued samples
+     * in order. Samples of a topic being resolved are queued behind the pending ones, so the publication order is kept.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] json JSON sample to be published.
+     * @param [in] callback Function notified of the outcome of the publication (may be empty). It is called either
+     * from this method or from a background thread.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void publish_async(
+            const std::string& topic_name,
+            const std::string& json,
+            PublishCompletion callback = nullptr);
+
+    /**
+     * @brief Resolve a topic in the background, so its first publication does not have to wait for it.
+     *
+     * Samples published asynchronously while the topic is being resolved are queued until it is ready, and synchronous
+     * publications wait for the resolution to finish.
+     *
+     * @param [in] topic_name Name of the topic.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void declare_topic(
+            const std::string& topic_name);
+
+    /**
+     * @brief Publish several JSON samples in a topic, resolving it only once.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] jsons JSON samples to be published, in publication order.
+     * @param [out] results Whether each sample was published.
+     * @return \c true if every sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish_batch(
+            const std::string& topic_name,
+            const std::vector<std::string>& jsons,
+            std::vector<bool>& results);
+
+    /**
+     * @brief Publish several JSON samples in a resolved topic.
+     *
+     * Samples are serialized first (large batches concurrently, in chunks run by the thread pool and the calling
+     * thread), and then injected in the pipe in order, so a failed sample does not prevent the rest from being
+     * published.
+     *
+     * @param [in] handle Handle of the topic, obtained with \c resolve_topic .
+     * @param [in] jsons JSON samples to be published, in publication order.
+     * @param [out] results Whether each sample was published.
+     * @return \c true if every sample was published, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish_batch(
+            const TopicHandle& handle,
+            const std::vector<std::string>& jsons,
+            std::vector<bool>& results);
+
+    /**
+     * @brief Publish the samples contained in a JSON array or in NDJSON text (one sample per line) in a topic.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] batch JSON array of samples, or newline delimited JSON samples (blank lines are ignored).
+     * @param [out] results Whether each sample was published.
+     * @return \c true if every sample was published, \c false otherwise (or if the batch could not be split).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool publish_batch_json(
+            const std::string& topic_name,
+            const std::string& batch,
+            std::vector<bool>& results);
+
     DDSENABLER_PARTICIPANTS_DllAPI
     void set_topic_query_callback(
             participants::DdsTopicQuery callback)
@@ -62,6 +256,57 @@ public:
 
 protected:
 
+    //! Sample waiting for its topic to be resolved
+    struct PendingPublication
+    {
+        std::string json;
+        PublishCompletion callback;
+    };
+
+    //! Chunks of batch serialization waiting to be run, shared with the thread pool slot running them
+    struct SerializationQueue
+    {
+        //! Run the oldest pending chunk, returning whether there was any
+        bool run_next();
+
+        std::mutex mtx;
+
+        std::deque<std::function<void()>> chunks;
+    };
+
+    //! Background resolution of a topic
+    struct Resolution
+    {
+        std::thread thread;
+
+        //! Whether the thread is done (and can be joined right away)
+        bool finished {false};
+    };
+
+    //! Create a topic through the topic query callback, waiting for its reader (must be called without the mutex)
+    bool create_topic_(
+            const std::string& topic_name,
+            std::string& type_name,
+            std::shared_ptr<ddspipe::participants::InternalReader>& reader);
+
+    //! Start resolving a topic in the background
+    void start_resolution_nts_(
+            const std::string& topic_name);
+
+    //! Resolve a topic and publish its queued samples
+    void resolution_routine_(
+            std::string topic_name,
+            Resolution* resolution);
+
+    //! Serialize a JSON sample of the given topic, ready to be injected in its reader (\c nullptr on failure)
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> serialize_sample_(
+            const TopicHandle& handle,
+            const std::string& json);
+
+    //! Data representation the samples published in the given topic are serialized with
+    fastdds::dds::DataRepresentationId_t data_representation_(
+            const std::string& topic_name) const;
+
     std::shared_ptr<ddspipe::participants::InternalReader> lookup_reader_nts_(
             const std::string& topic_name,
             std::string& type_name) const;
@@ -69,13 +314,46 @@ protected:
     std::shared_ptr<ddspipe::participants::InternalReader> lookup_reader_nts_(
             const std::string& topic_name) const;
 
-    std::map<ddspipe::core::types::DdsTopic, std::shared_ptr<ddspipe::participants::InternalReader>> readers_;
+    using ReadersMap = std::map<ddspipe::core::types::DdsTopic, std::shared_ptr<ddspipe::participants::InternalReader>>;
+
+    ReadersMap readers_;
+
+    //! Reader of each topic name (the first one created, if several types share the name)
+    std::unordered_map<std::string, ReadersMap::const_iterator> readers_by_name_;
+
+    //! Minimum number of samples of each chunk serialized concurrently when publishing a batch
+    static constexpr size_t MIN_SAMPLES_PER_SERIALIZATION_CHUNK = 64;
 
     std::mutex mtx_;
 
+    //! Notified when a reader is created or a topic creation finishes
     std::condition_variable cv_;
 
+    //! Topics being created through the topic query callback
+    std::set<std::string> creating_topics_;
+
+    //! Samples queued for each topic being resolved in the background
+    std::map<std::string, std::deque<PendingPublication>> pending_publications_;
+
+    //! Background resolutions (list elements do not move, so threads can refer to them)
+    std::list<Resolution> resolutions_;
+
+    //! Whether the participant is being destroyed (set with the mutex taken, read without it while waiting for readers)
+    std::atomic<bool> stop_ {false};
+
     DdsTopicQuery topic_query_callback_;
+
+    //! Readers matched by the DDS writers, waited for before the first publication in a topic (fixed wait if not set)
+    std::shared_ptr<WriterMatchTracker> match_tracker_;
+
+    //! Thread pool serializing large batches concurrently (serialized in the calling thread if not set)
+    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+
+    //! Slot of the thread pool running a batch serialization chunk
+    utils::TaskId serialization_task_id_;
+
+    //! Batch serialization chunks pending (kept alive by the thread pool slot, which may run after destruction)
+    std::shared_ptr<SerializationQueue> serialization_queue_;
 };
 
 } /* namespace participants */
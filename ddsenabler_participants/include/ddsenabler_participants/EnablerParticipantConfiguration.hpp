@@ -14,6 +14,12 @@
 
 #pragma once
 
+#include <map>
+#include <set>
+#include <string>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 
 #include <ddsenabler_participants/library/library_dll.h>
@@ -40,7 +46,20 @@ public:
     // VARIABLES
     /////////////////////////
 
+    //! Maximum time (ms) the first publication in a topic created by the enabler waits for external readers to match
     unsigned int initial_publish_wait {0u};
+
+    //! Number of matched external readers the first publication in a topic created by the enabler waits for
+    unsigned int initial_publish_matched_readers {1u};
+
+    //! Topics to be created (with their writers) at startup, so their first publication does not have to wait
+    std::set<std::string> publish_topics;
+
+    //! Data representation of the published samples (XCDR1 by default, as ROS 2 distributions prior to Kilted expect)
+    fastdds::dds::DataRepresentationId_t data_representation {fastdds::dds::XCDR_DATA_REPRESENTATION};
+
+    //! Data representation of the samples published in specific topics, overriding \c data_representation
+    std::map<std::string, fastdds::dds::DataRepresentationId_t> topic_data_representations;
 };
 
 } /* namespace participants */
@@ -0,0 +1,232 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file JsonCdrEncoder.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Encodes JSON (EPROSIMA format) samples into CDR without materializing a \c DynamicData.
+ *
+ * An encode plan is computed once from the \c DynamicType of the samples, and then reused for every sample of that
+ * type: the JSON text is tokenized, and the members are written in serialization order straight into a payload
+ * reserved from a payload pool, whose exact size is computed beforehand from the tokens. The resulting payload is
+ * identical to the one obtained by deserializing the JSON text into a \c DynamicData with \c json_deserialize and
+ * serializing it with \c DynamicPubSubType .
+ *
+ * Only final and appendable structures of primitives, strings, enumerations, sequences, arrays and nested structures
+ * (without optional members) are supported. Samples that cannot be encoded (e.g. missing or unknown members) are
+ * reported through the return value, so the caller can fall back to the \c DynamicData path.
+ */
+class JsonCdrEncoder
+{
+public:
+
+    /**
+     * @brief Build an encoder for the given type.
+     *
+     * The encode plan is validated against \c DynamicPubSubType with a default constructed sample (both in XCDR1 and
+     * XCDR2), so types whose serialization cannot be reproduced are rejected.
+     *
+     * @param [in] dyn_type DynamicType of the samples to be encoded.
+     * @return The encoder, or \c nullptr if the type is not supported.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    static std::unique_ptr<JsonCdrEncoder> create(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+
+    /**
+     * @brief Encode a JSON sample into a payload reserved from the given pool.
+     *
+     * @param [in] json JSON text of the sample.
+     * @param [in] data_representation Representation to be used.
+     * @param [in] payload_pool Pool the payload is reserved from.
+     * @param [out] payload Payload where the sample is serialized (including its encapsulation header).
+     * @return \c true if the sample was encoded, \c false otherwise (no payload is reserved).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool encode(
+            const std::string& json,
+            fastdds::dds::DataRepresentationId_t data_representation,
+            ddspipe::core::PayloadPool& payload_pool,
+            fastdds::rtps::SerializedPayload_t& payload) const;
+
+protected:
+
+    //! Kind of a node in the encode plan (aliases are resolved when building it)
+    enum class NodeKind : uint8_t
+    {
+        BOOLEAN,
+        BYTE,
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT32,
+        FLOAT64,
+        CHAR8,
+        STRING8,
+        ENUM,
+        STRUCTURE,
+        SEQUENCE,
+        ARRAY
+    };
+
+    //! Member of a structure
+    struct Member
+    {
+        //! Member name
+        std::string name;
+
+        //! Index of the member type in the plan
+        uint32_t node {0};
+    };
+
+    //! Node of the encode plan
+    struct Node
+    {
+        NodeKind kind {NodeKind::STRUCTURE};
+
+        //! Whether structures are serialized with a DHEADER in XCDR2 (i.e. appendable)
+        bool delimited {false};
+
+        //! Members of structures, in serialization order
+        std::vector<Member> members;
+
+        //! Member indexes sorted by member name (used to look up JSON keys)
+        std::vector<uint32_t> members_by_name;
+
+        //! Underlying type of enumerations
+        NodeKind literal_kind {NodeKind::INT32};
+
+        //! Enumerator values by name
+        std::map<std::string, int64_t, std::less<>> enumerators;
+
+        //! Collection element type
+        uint32_t element {0};
+
+        //! Maximum length of strings and sequences (0 if unbounded)
+        uint32_t bound {0};
+
+        //! Array dimensions
+        std::vector<uint32_t> dimensions;
+
+        //! Whether the collection elements are serialized without DHEADER in XCDR2
+        bool primitive_element {false};
+    };
+
+    struct Context;
+    class SizeWriter;
+    class BufferWriter;
+
+    JsonCdrEncoder() = default;
+
+    //! Build the plan node of a type, returning its index
+    uint32_t build_node_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            std::map<fastdds::dds::DynamicType*, uint32_t>& visited);
+
+    //! Check the plan reproduces \c DynamicPubSubType output for a default constructed sample
+    bool validate_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type) const;
+
+    //! Tokenize a JSON text into the context
+    bool tokenize_(
+            const std::string& json,
+            Context& ctx) const;
+
+    //! Encapsulation identifier of the samples in the given representation
+    uint16_t encapsulation_(
+            bool xcdr2) const;
+
+    template<typename Writer>
+    void encode_value_(
+            Writer& writer,
+            uint32_t node_index,
+            uint32_t token_index,
+            Context& ctx) const;
+
+    template<typename Writer>
+    void encode_structure_(
+            Writer& writer,
+            const Node& node,
+            uint32_t token_index,
+            Context& ctx) const;
+
+    template<typename Writer>
+    void encode_sequence_(
+            Writer& writer,
+            const Node& node,
+            uint32_t token_index,
+            Context& ctx) const;
+
+    template<typename Writer>
+    void encode_array_dimension_(
+            Writer& writer,
+            const Node& node,
+            size_t dimension,
+            uint32_t token_index,
+            Context& ctx) const;
+
+    template<typename Writer>
+    void encode_primitive_(
+            Writer& writer,
+            NodeKind kind,
+            uint32_t token_index,
+            Context& ctx) const;
+
+    //! Encode the tokenized sample into the given buffer, whose size must be the one computed beforehand
+    void write_(
+            unsigned char* buffer,
+            size_t size,
+            bool xcdr2,
+            Context& ctx) const;
+
+    //! Compute the serialized size (encapsulation header included) of the tokenized sample
+    size_t size_(
+            bool xcdr2,
+            Context& ctx) const;
+
+    //! Encode plan, the root structure being the first node
+    std::vector<Node> nodes_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,112 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadLoan.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsenabler_participants/TopicHandle.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Payload of the payload pool loaned to the caller, so a sample can be serialized straight into it and then
+ * published without any intermediate copy.
+ *
+ * Obtained with \c EnablerParticipant::loan_payload and published with \c EnablerParticipant::commit_payload .
+ * A loan that is never committed returns its payload to the pool when destroyed.
+ */
+class PayloadLoan
+{
+public:
+
+    PayloadLoan() = default;
+
+    PayloadLoan(
+            PayloadLoan&&) = default;
+
+    PayloadLoan& operator =(
+            PayloadLoan&&) = default;
+
+    //! Whether the loan holds a payload (i.e. it has been loaned and not committed yet)
+    bool valid() const noexcept
+    {
+        return nullptr != data_;
+    }
+
+    //! Writable region of the payload, where the serialized sample (starting with its encapsulation header) is written
+    unsigned char* data() noexcept
+    {
+        return valid() ? data_->payload.data : nullptr;
+    }
+
+    //! Size of the serialized sample to publish, the size requested on loan unless changed with \c set_size
+    uint32_t size() const noexcept
+    {
+        return valid() ? data_->payload.length : 0u;
+    }
+
+    //! Size of the writable region
+    uint32_t capacity() const noexcept
+    {
+        return valid() ? data_->payload.max_size : 0u;
+    }
+
+    /**
+     * @brief Set the size of the serialized sample, when it ends up shorter than the size requested on loan.
+     *
+     * @param [in] size Size of the serialized sample, greater than 0 and not exceeding \c capacity .
+     * @return \c true if the size was set, \c false otherwise.
+     */
+    bool set_size(
+            uint32_t size) noexcept
+    {
+        if (!valid() || 0u == size || size > capacity())
+        {
+            return false;
+        }
+
+        data_->payload.length = size;
+        return true;
+    }
+
+    //! Handle of the topic the payload is published in
+    const TopicHandle& topic() const noexcept
+    {
+        return handle_;
+    }
+
+protected:
+
+    friend class EnablerParticipant;
+
+    //! Topic the payload is published in
+    TopicHandle handle_;
+
+    //! Data holding the loaned payload (released to its pool on destruction if not committed)
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,137 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SchemaNotifier.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Background stage notifying new schemas, so bursts of discovered types do not stall their registration.
+ *
+ * Schemas are queued on registration and notified by a pool of threads, so several schemas may be prepared in
+ * parallel. Notifications that must follow the one of a schema (e.g. its topics and samples) wait for it with \c wait ,
+ * which returns right away (without locking) while no schema is pending.
+ */
+class SchemaNotifier
+{
+public:
+
+    //! Function notifying a schema
+    using NotificationFunction = std::function<void (
+                        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+                        const fastdds::dds::xtypes::TypeIdentifier& type_id)>;
+
+    /**
+     * @brief Start the notification threads.
+     *
+     * @param [in] n_threads Number of notification threads.
+     * @param [in] notify Function notifying a schema.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    SchemaNotifier(
+            unsigned int n_threads,
+            NotificationFunction notify);
+
+    /**
+     * @brief Notify the schemas still queued and stop the notification threads.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    ~SchemaNotifier();
+
+    /**
+     * @brief Queue the notification of a schema.
+     *
+     * @param [in] dyn_type DynamicType of the schema.
+     * @param [in] type_id TypeIdentifier of the schema.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void push(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const fastdds::dds::xtypes::TypeIdentifier& type_id);
+
+    /**
+     * @brief Wait until the schema of a type has been notified, if queued.
+     *
+     * @param [in] type_name Name of the type.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void wait(
+            const std::string& type_name) const;
+
+protected:
+
+    //! Schema pending notification
+    struct PendingSchema
+    {
+        fastdds::dds::DynamicType::_ref_type dyn_type;
+        fastdds::dds::xtypes::TypeIdentifier type_id;
+        std::string type_name;
+    };
+
+    //! Notify queued schemas until stopped
+    void notification_routine_();
+
+    //! Function notifying a schema
+    const NotificationFunction notify_;
+
+    //! Schemas waiting for a notification thread
+    std::deque<PendingSchema> queue_;
+
+    //! Number of queued or being notified schemas of each type
+    std::map<std::string, unsigned int> pending_types_;
+
+    //! Number of queued or being notified schemas (checked without locking)
+    std::atomic<size_t> pending_count_ {0};
+
+    //! Mutex synchronizing access to the queue
+    mutable std::mutex mtx_;
+
+    //! Wakes up notification threads when a schema is queued
+    std::condition_variable queue_cv_;
+
+    //! Wakes up threads waiting for a schema when it is notified
+    mutable std::condition_variable notified_cv_;
+
+    //! Whether the notification threads must stop
+    bool stop_ {false};
+
+    //! Notification threads
+    std::vector<std::thread> notification_threads_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,155 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SchemaRegistry.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include <ddsenabler_participants/TypeCodec.hpp>
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Insert-only registry of schemas, indexed by type name.
+ *
+ * Schemas are registered rarely but looked up for every received and published sample, so lookups never take a lock:
+ * the index is an open addressing hash table whose slots are published atomically, and it is replaced by a larger
+ * copy (never modified in place) when it grows. Schemas are never removed, so the pointers returned by \c find remain
+ * valid for the whole lifetime of the registry.
+ *
+ * Insertions are serialized internally and may run concurrently with lookups.
+ */
+class SchemaRegistry
+{
+public:
+
+    //! Registered schema
+    struct Schema
+    {
+        //! Name of the type
+        std::string type_name;
+
+        //! TypeIdentifier of the type
+        fastdds::dds::xtypes::TypeIdentifier type_id;
+
+        //! Codec of the type (holding its DynamicType)
+        std::shared_ptr<const TypeCodec> codec;
+
+        //! Hash of the type name
+        size_t hash {0};
+    };
+
+    DDSENABLER_PARTICIPANTS_DllAPI
+    SchemaRegistry();
+
+    DDSENABLER_PARTICIPANTS_DllAPI
+    ~SchemaRegistry();
+
+    SchemaRegistry(
+            const SchemaRegistry&) = delete;
+    SchemaRegistry& operator =(
+            const SchemaRegistry&) = delete;
+
+    /**
+     * @brief Look up the schema of a type (lock-free).
+     *
+     * @param [in] type_name Name of the type.
+     * @return The schema of the type, or \c nullptr if it has not been registered.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const Schema* find(
+            const std::string& type_name) const noexcept;
+
+    /**
+     * @brief Register the schema of a type.
+     *
+     * @param [in] type_name Name of the type.
+     * @param [in] type_id TypeIdentifier of the type.
+     * @param [in] codec Codec of the type.
+     * @return \c true if the schema was registered, \c false if the type was already registered (and kept as is).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool insert(
+            const std::string& type_name,
+            const fastdds::dds::xtypes::TypeIdentifier& type_id,
+            const std::shared_ptr<const TypeCodec>& codec);
+
+    //! Number of registered schemas
+    DDSENABLER_PARTICIPANTS_DllAPI
+    size_t size() const noexcept;
+
+    //! Whether no schema has been registered
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool empty() const noexcept;
+
+protected:
+
+    //! Hash table of schemas, with a power of two number of slots
+    struct Index
+    {
+        explicit Index(
+                size_t capacity);
+
+        //! Slot holding the given type, or the empty slot where it should be published
+        std::atomic<const Schema*>& probe(
+                size_t hash,
+                const std::string& type_name) const noexcept;
+
+        size_t mask;
+        std::unique_ptr<std::atomic<const Schema*>[]> slots;
+    };
+
+    //! Initial number of slots of the index
+    static constexpr size_t INITIAL_CAPACITY = 16;
+
+    //! Publish a schema in the given index (the index must have free slots)
+    static void publish_(
+            const Index& index,
+            const Schema* schema) noexcept;
+
+    //! Current index (the last one in \c indexes_ )
+    std::atomic<const Index*> index_;
+
+    //! Every index created. Those replaced by a larger one are kept until destruction, as readers may still be
+    //! probing them.
+    std::vector<std::unique_ptr<Index>> indexes_;
+
+    //! Schemas storage (addresses are stable, as elements are only appended)
+    std::deque<Schema> schemas_;
+
+    //! Number of registered schemas
+    std::atomic<size_t> size_ {0};
+
+    //! Mutex serializing insertions
+    std::mutex insertion_mtx_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
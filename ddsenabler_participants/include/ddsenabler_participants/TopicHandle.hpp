@@ -0,0 +1,66 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicHandle.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+#include <ddsenabler_participants/TypeCodec.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Resolved topic to publish in, obtained once so that publications do not need to look it up by name.
+ *
+ * Keeps alive the internal reader the samples are injected through and the codec of the topic type. Handles are cheap
+ * to copy, and remain usable as long as the enabler that resolved them.
+ */
+struct TopicHandle
+{
+    //! Whether the handle has been resolved
+    bool valid() const noexcept
+    {
+        return nullptr != reader && nullptr != codec;
+    }
+
+    //! Name of the topic
+    std::string topic_name;
+
+    //! Name of the topic type
+    std::string type_name;
+
+    //! Internal reader injecting the published samples in the pipe
+    std::shared_ptr<ddspipe::participants::InternalReader> reader;
+
+    //! Codec of the topic type
+    std::shared_ptr<const TypeCodec> codec;
+
+    //! Data representation the samples of the topic are serialized with
+    fastdds::dds::DataRepresentationId_t data_representation {fastdds::dds::XCDR_DATA_REPRESENTATION};
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
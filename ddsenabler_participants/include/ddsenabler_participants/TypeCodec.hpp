@@ -0,0 +1,243 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeCodec.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsenabler_participants/CdrJsonTranscoder.hpp>
+#include <ddsenabler_participants/JsonCdrEncoder.hpp>
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Usage counters of a DynamicData pool.
+ */
+struct DynamicDataPoolStatistics
+{
+    //! Number of DynamicData objects requested to the pool
+    uint64_t acquired {0};
+
+    //! Number of requests that allocated a new DynamicData object (allocations per sample = allocated / acquired)
+    uint64_t allocated {0};
+
+    //! Number of DynamicData objects currently kept for reuse
+    uint64_t pooled {0};
+};
+
+/**
+ * @brief Everything required to encode and decode the samples of a type, built once when its schema is added.
+ *
+ * Holds the pubsub type, the CDR to JSON transcoder, the JSON to CDR encoder and the pre-formatted JSON pieces of the
+ * type, so the data path does not need to look them up (or copy them) for every sample.
+ *
+ * @note All methods are const and can be called concurrently.
+ */
+class TypeCodec
+{
+public:
+
+    /**
+     * @brief Build the codec of a type.
+     *
+     * @param [in] dyn_type DynamicType of the samples to be encoded/decoded.
+     * @param [in] dynamic_data_pool_size Maximum number of DynamicData objects kept for reuse.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    explicit TypeCodec(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            unsigned int dynamic_data_pool_size = 0);
+
+    //! DynamicType of the samples
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const fastdds::dds::DynamicType::_ref_type& dyn_type() const noexcept
+    {
+        return dyn_type_;
+    }
+
+    //! Name of the type
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const std::string& type_name() const noexcept
+    {
+        return type_name_;
+    }
+
+    //! Name of the type formatted as a JSON string
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const std::string& type_name_json() const noexcept
+    {
+        return type_name_json_;
+    }
+
+    //! CDR to JSON transcoder, or \c nullptr if the type cannot be transcoded directly
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const CdrJsonTranscoder* transcoder() const noexcept
+    {
+        return transcoder_.get();
+    }
+
+    //! JSON to CDR encoder, or \c nullptr if the type cannot be encoded directly
+    DDSENABLER_PARTICIPANTS_DllAPI
+    const JsonCdrEncoder* encoder() const noexcept
+    {
+        return encoder_.get();
+    }
+
+    //! Whether the serialized size of the samples is bounded
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool is_bounded() const noexcept
+    {
+        return bounded_;
+    }
+
+    //! Maximum serialized size of the samples (only meaningful if bounded)
+    DDSENABLER_PARTICIPANTS_DllAPI
+    uint32_t max_serialized_size() const noexcept
+    {
+        return max_serialized_size_;
+    }
+
+    /**
+     * @brief Deserialize a payload into a DynamicData, reusing a pooled one if available.
+     *
+     * @param [in] payload Serialized sample.
+     * @return The deserialized sample, or \c nullptr if the payload could not be deserialized.
+     * @note The returned object should be given back with \c release once no longer used.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    fastdds::dds::DynamicData::_ref_type deserialize(
+            const fastdds::rtps::SerializedPayload_t& payload) const;
+
+    /**
+     * @brief Give back a DynamicData obtained with \c deserialize , so it can be reused.
+     *
+     * @param [in] dyn_data DynamicData to be reused (discarded if the pool is full or still referenced elsewhere).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void release(
+            fastdds::dds::DynamicData::_ref_type&& dyn_data) const;
+
+    //! Usage counters of the DynamicData pool
+    DDSENABLER_PARTICIPANTS_DllAPI
+    DynamicDataPoolStatistics dynamic_data_statistics() const;
+
+    /**
+     * @brief Calculate the serialized size of a sample.
+     *
+     * @param [in] dyn_data Sample to be serialized.
+     * @param [in] data_representation Representation to be used.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    uint32_t calculate_serialized_size(
+            const fastdds::dds::DynamicData::_ref_type& dyn_data,
+            fastdds::dds::DataRepresentationId_t data_representation) const;
+
+    /**
+     * @brief Serialize a sample.
+     *
+     * @param [in] dyn_data Sample to be serialized.
+     * @param [out] payload Payload where the sample is serialized (must be large enough).
+     * @param [in] data_representation Representation to be used.
+     * @return \c true if the sample was serialized, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool serialize(
+            const fastdds::dds::DynamicData::_ref_type& dyn_data,
+            fastdds::rtps::SerializedPayload_t& payload,
+            fastdds::dds::DataRepresentationId_t data_representation) const;
+
+    /**
+     * @brief Serialize a sample into a payload reserved from the given pool.
+     *
+     * The payload is reserved at the size bound of the type, or at an estimate of the serialized size for unbounded
+     * (or very large) types, so the sample is walked only once. Only when it does not fit (e.g. the first sample of an
+     * unbounded type) is its exact size calculated, growing the estimate for the next samples.
+     *
+     * @param [in] dyn_data Sample to be serialized.
+     * @param [in] data_representation Representation to be used.
+     * @param [in] payload_pool Pool the payload is reserved from.
+     * @param [out] payload Payload where the sample is serialized.
+     * @return \c true if the sample was serialized, \c false otherwise (no payload is reserved).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool serialize(
+            const fastdds::dds::DynamicData::_ref_type& dyn_data,
+            fastdds::dds::DataRepresentationId_t data_representation,
+            ddspipe::core::PayloadPool& payload_pool,
+            fastdds::rtps::SerializedPayload_t& payload) const;
+
+protected:
+
+    //! Maximum size bound used to reserve payloads, beyond which the serialized size is estimated as if unbounded
+    static constexpr uint32_t MAX_PRESIZED_PAYLOAD_SIZE = 64 * 1024;
+
+    //! DynamicType of the samples
+    fastdds::dds::DynamicType::_ref_type dyn_type_;
+
+    //! Name of the type, both raw and as a JSON string
+    std::string type_name_;
+    std::string type_name_json_;
+
+    //! PubSub type (its (de)serialization methods are not const, but do not modify its state)
+    mutable fastdds::dds::DynamicPubSubType pubsub_type_;
+
+    //! CDR to JSON transcoder (nullptr if not supported)
+    std::unique_ptr<CdrJsonTranscoder> transcoder_;
+
+    //! JSON to CDR encoder (nullptr if not supported)
+    std::unique_ptr<JsonCdrEncoder> encoder_;
+
+    //! Serialized size bound
+    bool bounded_ {false};
+    uint32_t max_serialized_size_ {0};
+
+    //! Size the payloads are reserved at for each representation (XCDR1, XCDR2), grown whenever a sample overflows it
+    mutable std::atomic<uint32_t> xcdr1_size_estimate_ {0};
+    mutable std::atomic<uint32_t> xcdr2_size_estimate_ {0};
+
+    //! DynamicData objects kept for reuse, and its maximum size
+    mutable std::vector<fastdds::dds::DynamicData::_ref_type> dynamic_data_pool_;
+    unsigned int dynamic_data_pool_size_ {0};
+
+    //! Mutex synchronizing access to the DynamicData pool
+    mutable std::mutex dynamic_data_pool_mtx_;
+
+    //! DynamicData pool counters
+    mutable std::atomic<uint64_t> dynamic_data_acquired_ {0};
+    mutable std::atomic<uint64_t> dynamic_data_allocated_ {0};
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,130 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeStore.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Persistent store of the types known by the enabler, kept in a single file.
+ *
+ * Each type is stored once, keyed by the hash of its TypeIdentifier, along with its serialized description in the
+ * same internal format exchanged through the type notification and query callbacks. The file is only appended to, and
+ * it is memory-mapped when loaded, so all the types can be registered at startup without any callback round trip.
+ *
+ * @note File layout (native byte order): an 8 byte magic string and a 4 byte version, followed by records made of
+ * their size (4 bytes), the type hash (14 bytes), the type name (4 bytes size + characters) and the serialized type
+ * (4 bytes size + data).
+ */
+class TypeStore
+{
+public:
+
+    /**
+     * @brief Function visiting each type of the store.
+     *
+     * @param [in] type_name Name of the type.
+     * @param [in] serialized_type Serialized type in internal format (only valid during the call).
+     * @param [in] serialized_type_size Size of the serialized type.
+     */
+    using Visitor = std::function<void (
+                        const std::string& type_name,
+                        const unsigned char* serialized_type,
+                        uint32_t serialized_type_size)>;
+
+    /**
+     * @brief Create a store kept in the given file (created on the first type stored if it does not exist).
+     *
+     * @param [in] file_path Path of the store file.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    explicit TypeStore(
+            const std::string& file_path);
+
+    /**
+     * @brief Visit all the types in the store file, in the order they were stored.
+     *
+     * Incomplete records (e.g. left by an interrupted write) are discarded from the file.
+     *
+     * @param [in] visitor Function called for each type.
+     * @return \c true if the file was loaded (or does not exist yet), \c false if it is not a valid store.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool load(
+            const Visitor& visitor);
+
+    /**
+     * @brief Add a type to the store, unless already stored.
+     *
+     * @param [in] type_identifier Type identifier of the type (only hashed identifiers can be stored).
+     * @param [in] type_name Name of the type.
+     * @param [in] serialized_type Serialized type in internal format.
+     * @param [in] serialized_type_size Size of the serialized type.
+     * @return \c true if the type is stored, \c false otherwise.
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool store(
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+            const std::string& type_name,
+            const unsigned char* serialized_type,
+            uint32_t serialized_type_size);
+
+    //! Whether the given type is stored
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool contains(
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier) const;
+
+    //! Number of types stored
+    DDSENABLER_PARTICIPANTS_DllAPI
+    size_t size() const;
+
+protected:
+
+    //! Key of a type in the store
+    using Key = fastdds::dds::xtypes::EquivalenceHash;
+
+    //! Get the key of a type (\c false if its identifier is not hashed)
+    static bool get_key_(
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+            Key& key);
+
+    //! Path of the store file
+    std::string file_path_;
+
+    //! Keys of the types in the store file
+    std::set<Key> keys_;
+
+    //! Mutex synchronizing access to the store file
+    mutable std::mutex mtx_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
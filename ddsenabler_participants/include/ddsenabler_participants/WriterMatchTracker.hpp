@@ -0,0 +1,103 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterMatchTracker.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <fastdds/rtps/common/Guid.hpp>
+
+#include <ddsenabler_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+/**
+ * @brief Number of external readers matched by the DDS writers of each topic.
+ *
+ * Fed by the writers created in the DDS participant, and queried before the first publication in a topic so it is not
+ * sent before the external readers have matched. Readers are counted per writer, and the readers of a topic are those
+ * of its writer with the most matches (so a reader matched by several writers of the topic is not counted twice).
+ */
+class WriterMatchTracker
+{
+public:
+
+    /**
+     * @brief Account an external reader matching (or unmatching) a writer of the given topic.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] writer_guid GUID of the writer.
+     * @param [in] matched Whether the reader matched (\c true ) or unmatched (\c false ).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void on_writer_matched(
+            const std::string& topic_name,
+            const fastdds::rtps::GUID_t& writer_guid,
+            bool matched);
+
+    /**
+     * @brief Wait until the writers of the given topic have matched a minimum number of readers.
+     *
+     * @param [in] topic_name Name of the topic.
+     * @param [in] min_readers Minimum number of matched readers.
+     * @param [in] timeout Maximum time to wait.
+     * @param [in] stop Condition ending the wait early (may be empty), checked again on \c interrupt_waits .
+     * @return \c true if the readers matched in time, \c false otherwise (or if stopped).
+     */
+    DDSENABLER_PARTICIPANTS_DllAPI
+    bool wait_for_readers(
+            const std::string& topic_name,
+            unsigned int min_readers,
+            std::chrono::milliseconds timeout,
+            const std::function<bool()>& stop = nullptr) const;
+
+    //! Wake up the ongoing waits, so they check their stop condition again
+    DDSENABLER_PARTICIPANTS_DllAPI
+    void interrupt_waits() const;
+
+    //! Number of readers currently matched by the writers of the given topic
+    DDSENABLER_PARTICIPANTS_DllAPI
+    unsigned int matched_readers(
+            const std::string& topic_name) const;
+
+protected:
+
+    //! Number of readers matched by the given writers (those with the most matches)
+    static unsigned int matched_readers_nts_(
+            const std::map<fastdds::rtps::GUID_t, unsigned int>& writers);
+
+    //! Matched readers of each writer, per topic
+    std::map<std::string, std::map<fastdds::rtps::GUID_t, unsigned int>> matched_readers_;
+
+    //! Mutex synchronizing access to the counters
+    mutable std::mutex mtx_;
+
+    //! Notified whenever a counter changes
+    mutable std::condition_variable cv_;
+};
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
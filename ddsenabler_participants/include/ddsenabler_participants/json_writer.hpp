@@ -0,0 +1,121 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file json_writer.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+namespace json_writer {
+
+//! Number of spaces per indentation level (same as \c nlohmann::json::dump(4) )
+constexpr uint32_t INDENTATION_SPACES = 4;
+
+/**
+ * @brief Append the indentation corresponding to the given level.
+ *
+ * @param [in,out] output String where the indentation is appended.
+ * @param [in] level Indentation level.
+ */
+void write_indentation(
+        std::string& output,
+        uint32_t level);
+
+/**
+ * @brief Append a quoted and escaped JSON string, following the same rules as \c nlohmann::json::dump .
+ *
+ * @param [in,out] output String where the JSON string is appended.
+ * @param [in] data Pointer to the UTF-8 characters to be written.
+ * @param [in] size Number of bytes to be written.
+ * @return \c true if the string was written, \c false if it is not valid UTF-8 (\c output is left unmodified).
+ */
+bool write_string(
+        std::string& output,
+        const char* data,
+        size_t size);
+
+/**
+ * @brief Append a quoted and escaped JSON string.
+ *
+ * @param [in,out] output String where the JSON string is appended.
+ * @param [in] value String to be written.
+ * @return \c true if the string was written, \c false if it is not valid UTF-8.
+ */
+bool write_string(
+        std::string& output,
+        const std::string& value);
+
+/**
+ * @brief Append a signed integer.
+ */
+void write_integer(
+        std::string& output,
+        int64_t value);
+
+/**
+ * @brief Append an unsigned integer.
+ */
+void write_unsigned(
+        std::string& output,
+        uint64_t value);
+
+/**
+ * @brief Append a floating point number, with the same (shortest round-trip) format as \c nlohmann::json::dump .
+ *
+ * @note Non-finite values are written as \c null .
+ */
+void write_float(
+        std::string& output,
+        double value);
+
+/**
+ * @brief Append a boolean literal.
+ */
+void write_boolean(
+        std::string& output,
+        bool value);
+
+/**
+ * @brief Append an already formatted JSON text, nesting it at the given indentation level.
+ *
+ * @param [in,out] output String where the JSON text is appended.
+ * @param [in] json JSON text formatted with 4 spaces indentation at level 0.
+ * @param [in] level Indentation level at which the text is nested.
+ */
+void write_nested(
+        std::string& output,
+        const std::string& json,
+        uint32_t level);
+
+/**
+ * @brief Append the UTF-8 encoding of a code point.
+ *
+ * @return \c true if the code point was encoded, \c false if it is not a valid Unicode scalar value.
+ */
+bool write_utf8(
+        std::string& output,
+        uint32_t code_point);
+
+} /* namespace json_writer */
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -18,8 +18,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <fastdds/dds/xtypes/type_representation/detail/dds_xtypes_typeobject.hpp>
 #include <fastdds/rtps/common/SerializedPayload.hpp>
@@ -33,6 +35,14 @@ namespace ddsenabler {
 namespace participants {
 namespace serialization {
 
+//! Type deserialized from a type bundle or a \c DynamicTypesCollection
+struct DeserializedType
+{
+    std::string type_name;
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    fastdds::dds::xtypes::TypeObject type_object;
+};
+
 /**
  * @brief Serialize a \c TopicQoS struct into a string.
  *
@@ -116,6 +126,42 @@ bool deserialize_dynamic_types(
         uint32_t dynamic_types_payload_size,
         DynamicTypesCollection& dynamic_types);
 
+/**
+ * @brief Serialize a dynamic type and its dependencies into a type bundle.
+ *
+ * A type bundle is a compact binary alternative to a serialized \c DynamicTypesCollection. It starts with a 12 byte
+ * header (the "DETB" magic string, a 1 byte version, 1 byte of flags, 2 reserved bytes and the number of types),
+ * followed by an index with the offset and size of the name, TypeIdentifier and TypeObject of every type, and then by
+ * their data. TypeIdentifiers and TypeObjects are kept as raw XCDR2 (in the byte order given by the flags), so they
+ * can be decoded straight from the buffer. Integers in header and index are little endian. Dependencies come first,
+ * named after the type with an index suffix, and the type itself last.
+ *
+ * @param [in] type_name Name of the dynamic type
+ * @param [in] type_identifier Type identifier of the dynamic type
+ * @param [out] bundle Type bundle
+ * @return True if serialization was successful, false otherwise
+ */
+bool serialize_type_bundle(
+        const std::string& type_name,
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        std::vector<unsigned char>& bundle);
+
+/**
+ * @brief Deserialize the types contained in a type bundle or in a serialized \c DynamicTypesCollection.
+ *
+ * Type bundles are decoded without copying their contents, while serialized collections are accepted for
+ * compatibility.
+ *
+ * @param [in] serialized_types Pointer to the type bundle or serialized collection
+ * @param [in] serialized_types_size Size of the type bundle or serialized collection
+ * @param [out] types Deserialized types, in the same order
+ * @return True if deserialization was successful, false otherwise
+ */
+bool deserialize_types(
+        const unsigned char* serialized_types,
+        uint32_t serialized_types_size,
+        std::vector<DeserializedType>& types);
+
 } /* namespace serialization */
 } /* namespace participants */
 } /* namespace ddsenabler */
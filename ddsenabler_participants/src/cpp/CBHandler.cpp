@@ -26,7 +26,6 @@
 #include <cpp_utils/exception/InconsistencyException.hpp>
 
 #include <ddsenabler_participants/serialization.hpp>
-#include <ddsenabler_participants/types/dynamic_types_collection/DynamicTypesCollection.hpp>
 
 #include <ddsenabler_participants/CBHandler.hpp>
 
@@ -46,12 +45,51 @@ CBHandler::CBHandler(
             "Creating CB handler instance.");
 
     cb_writer_ = std::make_unique<CBWriter>();
+    cb_writer_->set_type_format(configuration_.type_format);
+
+    if (configuration_.delivery_queue_size > 0)
+    {
+        delivery_queue_ = std::make_unique<DeliveryQueue>(
+            configuration_.delivery_queue_size,
+            configuration_.delivery_policy,
+            configuration_.delivery_threads,
+            [this](const CBMessage& msg)
+            {
+                write_sample_nts_(msg);
+            },
+            configuration_.coalesced_topics);
+    }
+
+    if (configuration_.schema_notification_threads > 0)
+    {
+        schema_notifier_ = std::make_unique<SchemaNotifier>(
+            configuration_.schema_notification_threads,
+            [this](const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const fastdds::dds::xtypes::TypeIdentifier& type_id)
+            {
+                cb_writer_->write_schema(dyn_type, type_id);
+            });
+    }
+
+    if (!configuration_.type_store_path.empty())
+    {
+        type_store_ = std::make_shared<TypeStore>(configuration_.type_store_path);
+        cb_writer_->set_type_store(type_store_);
+
+        std::lock_guard<std::mutex> lock(mtx_);
+        load_type_store_nts_();
+    }
 }
 
 CBHandler::~CBHandler()
 {
     EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
             "Destroying CB handler.");
+
+    // Notify the pending schemas (releasing the samples waiting for them) and stop the delivery threads before the
+    // writer and the codecs they use are destroyed
+    schema_notifier_.reset();
+    delivery_queue_.reset();
 }
 
 void CBHandler::add_schema(
@@ -66,6 +104,12 @@ void CBHandler::add_schema(
 void CBHandler::add_topic(
         const DdsTopic& topic)
 {
+    // Topics are notified after the schema of their type
+    if (schema_notifier_)
+    {
+        schema_notifier_->wait(topic.type_name);
+    }
+
     std::lock_guard<std::mutex> lock(mtx_);
 
     EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
@@ -78,119 +122,107 @@ void CBHandler::add_data(
         const DdsTopic& topic,
         RtpsPayloadData& data)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-
     EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
             "Adding data in topic: " << topic << ".");
 
-    fastdds::dds::DynamicType::_ref_type dyn_type;
-    auto it = schemas_.find(topic.type_name);
-    if (it == schemas_.end())
+    const SchemaRegistry::Schema* schema = schemas_.find(topic.type_name);
+    if (nullptr == schema)
     {
         EPROSIMA_LOG_WARNING(DDSENABLER_CB_HANDLER,
                 "Schema for type " << topic.type_name << " not available.");
         return;
     }
-    dyn_type = it->second.second;
 
-    CBMessage msg;
-    msg.sequence_number = unique_sequence_number_++;
-    msg.publish_time = data.source_timestamp;
-    if (data.payload.length > 0)
-    {
-        msg.topic = topic;
-        msg.instanceHandle = data.instanceHandle;
-        msg.source_guid = data.source_guid;
-
-        if (data.payload_owner != nullptr)
-        {
-            payload_pool_->get_payload(
-                data.payload,
-                msg.payload);
-
-            msg.payload_owner = payload_pool_.get();
-        }
-        else
-        {
-            throw utils::InconsistencyException(STR_ENTRY << "Payload owner not found in data received.");
-        }
-    }
-    else
+    // Hand the sample over to the delivery threads, so a slow consumer does not stall the reception thread
+    if (delivery_queue_)
     {
-        throw utils::InconsistencyException(STR_ENTRY << "Received sample with no payload.");
+        auto msg = std::make_unique<CBMessage>();
+        fill_message_(topic, data, *schema, *msg);
+        delivery_queue_->push(std::move(msg));
+        return;
     }
 
-    write_sample_nts_(msg, dyn_type);
+    // Only samples of the same topic are serialized, so their notifications keep the reception order
+    std::shared_ptr<std::mutex> topic_mtx = get_topic_mutex_(topic.topic_name());
+    std::lock_guard<std::mutex> topic_lock(*topic_mtx);
+
+    CBMessage msg;
+    fill_message_(topic, data, *schema, msg);
+    write_sample_nts_(msg);
 }
 
 bool CBHandler::get_type_identifier(
         const std::string& type_name,
         fastdds::dds::xtypes::TypeIdentifier& type_identifier)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-
-    auto it = schemas_.find(type_name);
-    if (it != schemas_.end())
+    const SchemaRegistry::Schema* schema = schemas_.find(type_name);
+    if (nullptr != schema)
     {
-        type_identifier = it->second.first;
+        type_identifier = schema->type_id;
         return true;
     }
 
-    // Try to retrieve it from local registry
-    fastdds::dds::xtypes::TypeIdentifierPair type_ids;
-    if (fastdds::dds::RETCODE_OK ==
-            fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
-                type_name, type_ids))
     {
-        // Get complete type object
-        type_identifier =
-                (fastdds::dds::xtypes::EK_COMPLETE ==
-                type_ids.type_identifier1()._d()) ? type_ids.type_identifier1() : type_ids.type_identifier2();
-        fastdds::dds::xtypes::TypeObject type_object;
-        if (fastdds::dds::RETCODE_OK ==
-                fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
-                    type_identifier, type_object))
+        std::unique_lock<std::mutex> lock(resolution_mtx_);
+
+        // Only one resolution per type at a time, whose outcome is shared by the concurrent requests
+        if (resolving_types_.count(type_name) > 0)
         {
-            // If already in the registry, just add it to schemas map. Also report to the user the schema and all
-            // associated data required for persistence in case she does not have it yet.
-            if (add_schema_nts_(type_identifier, type_object, true))
+            resolution_cv_.wait(lock, [&]()
+                    {
+                        return 0 == resolving_types_.count(type_name);
+                    });
+
+            schema = schemas_.find(type_name);
+            if (nullptr == schema)
             {
-                return true;
+                return false;
             }
-            // If failed to add schema from the type object found in the registry, attempt requesting it to the user
+
+            type_identifier = schema->type_id;
+            return true;
         }
-    }
 
-    if (!type_query_callback_)
-    {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Type query callback not set.");
-        return false;
-    }
+        // Check again, as the schema might have been added meanwhile
+        schema = schemas_.find(type_name);
+        if (nullptr != schema)
+        {
+            type_identifier = schema->type_id;
+            return true;
+        }
 
-    std::unique_ptr<const unsigned char []> serialized_type;
-    uint32_t serialized_type_size;
-    if (!type_query_callback_(type_name.c_str(), serialized_type, serialized_type_size))
-    {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Type query callback failed to retrieve " << type_name << " type.");
-        return false;
+        // Do not query again the types the user recently failed to provide
+        auto unknown_type = unknown_types_.find(type_name);
+        if (unknown_type != unknown_types_.end())
+        {
+            if (std::chrono::steady_clock::now() < unknown_type->second)
+            {
+                EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
+                        "Type " << type_name << " recently failed to be resolved, not querying it again yet.");
+                return false;
+            }
+
+            unknown_types_.erase(unknown_type);
+        }
+
+        resolving_types_.insert(type_name);
     }
 
-    // Register the type obtained through the type query callback
-    fastdds::dds::xtypes::TypeObject type_object;
-    if (!register_type_nts_(type_name, serialized_type.get(), serialized_type_size, type_identifier, type_object))
+    const bool resolved = resolve_type_(type_name, type_identifier);
+
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Failed to register type " << type_name << ".");
-        return false;
-    }
+        std::lock_guard<std::mutex> lock(resolution_mtx_);
 
-    // Add to schemas map, but do not report it to the user as it is the exact same information we obtained through the
-    // type query callback.
-    add_schema_nts_(type_identifier, type_object, false);
+        resolving_types_.erase(type_name);
+        if (!resolved && configuration_.unknown_type_ttl > 0)
+        {
+            unknown_types_[type_name] = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(configuration_.unknown_type_ttl);
+        }
+    }
+    resolution_cv_.notify_all();
 
-    return true;
+    return resolved;
 }
 
 bool CBHandler::get_serialized_data(
@@ -198,21 +230,36 @@ bool CBHandler::get_serialized_data(
         const std::string& json,
         Payload& payload)
 {
-    std::lock_guard<std::mutex> lock(mtx_);
-
-    fastdds::dds::DynamicType::_ref_type dyn_type;
-    auto it = schemas_.find(type_name);
-    if (it == schemas_.end())
+    const SchemaRegistry::Schema* schema = schemas_.find(type_name);
+    if (nullptr == schema)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
                 "Failed to deserialize data for type " << type_name << " : schema not available.");
         return false;
     }
-    dyn_type = it->second.second;
+
+    // Use XCDR1 for backwards compatibility (e.g. ROS 2 distributions prior to Kilted)
+    return get_serialized_data(*schema->codec, json, payload, fastdds::dds::XCDR_DATA_REPRESENTATION);
+}
+
+bool CBHandler::get_serialized_data(
+        const TypeCodec& codec,
+        const std::string& json,
+        Payload& payload,
+        fastdds::dds::DataRepresentationId_t data_representation)
+{
+    const std::string& type_name = codec.type_name();
+
+    // Encode directly when possible, falling back to the DynamicData path otherwise (e.g. missing members)
+    if (nullptr != codec.encoder() &&
+            codec.encoder()->encode(json, data_representation, *payload_pool_, payload))
+    {
+        return true;
+    }
 
     fastdds::dds::DynamicData::_ref_type dyn_data;
     if ((fastdds::dds::RETCODE_OK !=
-            fastdds::dds::json_deserialize(json, dyn_type, fastdds::dds::DynamicDataJsonFormat::EPROSIMA,
+            fastdds::dds::json_deserialize(json, codec.dyn_type(), fastdds::dds::DynamicDataJsonFormat::EPROSIMA,
             dyn_data)) || !dyn_data)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
@@ -220,19 +267,7 @@ bool CBHandler::get_serialized_data(
         return false;
     }
 
-    // Use XCDR1 for backwards compatibility (e.g. ROS 2 distributions prior to Kilted)
-    fastdds::dds::DynamicPubSubType pubsub_type (dyn_type);
-    uint32_t payload_size = pubsub_type.calculate_serialized_size(&dyn_data,
-                    fastdds::dds::DataRepresentationId::XCDR_DATA_REPRESENTATION);
-
-    if (!payload_pool_->get_payload(payload_size, payload))
-    {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Failed to deserialize data for type " << type_name << " : get_payload failed.");
-        return false;
-    }
-
-    if (!pubsub_type.serialize(&dyn_data, payload, fastdds::dds::DataRepresentationId::XCDR_DATA_REPRESENTATION))
+    if (!codec.serialize(dyn_data, data_representation, *payload_pool_, payload))
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
                 "Failed to deserialize data for type " << type_name << " : payload serialization failed.");
@@ -252,21 +287,24 @@ void CBHandler::add_schema_nts_(
     const std::string& type_name = dyn_type->get_name().to_string();
 
     // Check if it exists already
-    auto it = schemas_.find(type_name);
-    if (it != schemas_.end())
+    if (nullptr != schemas_.find(type_name))
     {
         return;
     }
-    schemas_[type_name] = {type_id, dyn_type};
 
-    // Add to schemas map
     EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
             "Adding schema with name " << type_name << ".");
 
+    // Notify (or queue the notification of) the schema before making it visible to the data path, so no sample is
+    // notified before its schema
     if (write_schema)
     {
         write_schema_nts_(dyn_type, type_id);
     }
+
+    // Add to schemas registry, along with the codec used to encode and decode its samples
+    schemas_.insert(type_name, type_id,
+            std::make_shared<const TypeCodec>(dyn_type, configuration_.dynamic_data_pool_size));
 }
 
 bool CBHandler::add_schema_nts_(
@@ -293,6 +331,12 @@ void CBHandler::write_schema_nts_(
         const fastdds::dds::DynamicType::_ref_type& dyn_type,
         const fastdds::dds::xtypes::TypeIdentifier& type_id)
 {
+    if (schema_notifier_)
+    {
+        schema_notifier_->push(dyn_type, type_id);
+        return;
+    }
+
     cb_writer_->write_schema(dyn_type, type_id);
 }
 
@@ -303,71 +347,277 @@ void CBHandler::write_topic_nts_(
 }
 
 void CBHandler::write_sample_nts_(
-        const CBMessage& msg,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+        const CBMessage& msg)
 {
-    cb_writer_->write_data(msg, dyn_type);
+    // Samples are notified after the schema of their type
+    if (schema_notifier_)
+    {
+        schema_notifier_->wait(msg.topic.type_name);
+    }
+
+    // Each notification is skipped (before any conversion) if its callback is not set
+    cb_writer_->write_raw_data(msg);
+    cb_writer_->write_data(msg);
 }
 
-bool CBHandler::register_type_nts_(
+bool CBHandler::get_type_codec(
         const std::string& type_name,
-        const unsigned char* serialized_type,
-        uint32_t serialized_type_size,
-        fastdds::dds::xtypes::TypeIdentifier& type_identifier,
-        fastdds::dds::xtypes::TypeObject& type_object)
+        std::shared_ptr<const TypeCodec>& codec) const
+{
+    const SchemaRegistry::Schema* schema = schemas_.find(type_name);
+    if (nullptr == schema)
+    {
+        return false;
+    }
+
+    codec = schema->codec;
+    return true;
+}
+
+bool CBHandler::get_dynamic_data_statistics(
+        const std::string& type_name,
+        DynamicDataPoolStatistics& statistics) const
+{
+    const SchemaRegistry::Schema* schema = schemas_.find(type_name);
+    if (nullptr == schema)
+    {
+        return false;
+    }
+
+    statistics = schema->codec->dynamic_data_statistics();
+    return true;
+}
+
+bool CBHandler::get_delivery_statistics(
+        const std::string& topic_name,
+        DeliveryQueueStatistics& statistics) const
+{
+    if (!delivery_queue_)
+    {
+        return false;
+    }
+
+    return delivery_queue_->get_statistics(topic_name, statistics);
+}
+
+void CBHandler::fill_message_(
+        const DdsTopic& topic,
+        RtpsPayloadData& data,
+        const SchemaRegistry::Schema& schema,
+        CBMessage& msg)
+{
+    msg.sequence_number = unique_sequence_number_++;
+    msg.publish_time = data.source_timestamp;
+    msg.codec = schema.codec.get();
+    if (data.payload.length > 0)
+    {
+        msg.topic = topic;
+        msg.instanceHandle = data.instanceHandle;
+        msg.source_guid = data.source_guid;
+
+        if (data.payload_owner != nullptr)
+        {
+            payload_pool_->get_payload(
+                data.payload,
+                msg.payload);
+
+            msg.payload_owner = payload_pool_.get();
+        }
+        else
+        {
+            throw utils::InconsistencyException(STR_ENTRY << "Payload owner not found in data received.");
+        }
+    }
+    else
+    {
+        throw utils::InconsistencyException(STR_ENTRY << "Received sample with no payload.");
+    }
+}
+
+std::shared_ptr<std::mutex> CBHandler::get_topic_mutex_(
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(topic_mutexes_mtx_);
+
+    std::shared_ptr<std::mutex>& topic_mtx = topic_mutexes_[topic_name];
+    if (nullptr == topic_mtx)
+    {
+        topic_mtx = std::make_shared<std::mutex>();
+    }
+
+    return topic_mtx;
+}
+
+bool CBHandler::resolve_type_(
+        const std::string& type_name,
+        fastdds::dds::xtypes::TypeIdentifier& type_identifier)
 {
-    DynamicTypesCollection dynamic_types;
-    if (!serialization::deserialize_dynamic_types(serialized_type, serialized_type_size, dynamic_types))
+    // Try to retrieve it from local registry
+    fastdds::dds::xtypes::TypeIdentifierPair type_ids;
+    if (fastdds::dds::RETCODE_OK ==
+            fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                type_name, type_ids))
+    {
+        // Get complete type object
+        type_identifier =
+                (fastdds::dds::xtypes::EK_COMPLETE ==
+                type_ids.type_identifier1()._d()) ? type_ids.type_identifier1() : type_ids.type_identifier2();
+        fastdds::dds::xtypes::TypeObject type_object;
+        if (fastdds::dds::RETCODE_OK ==
+                fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
+                    type_identifier, type_object))
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+
+            // If already in the registry, just add it to schemas map. Also report to the user the schema and all
+            // associated data required for persistence in case she does not have it yet.
+            if (add_schema_nts_(type_identifier, type_object, true))
+            {
+                return true;
+            }
+            // If failed to add schema from the type object found in the registry, attempt requesting it to the user
+        }
+    }
+
+    if (!type_query_callback_)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Failed to deserialize dynamic types collection.");
+                "Type query callback not set.");
         return false;
     }
 
-    std::string _type_name;
-    fastdds::dds::xtypes::TypeIdentifier _type_identifier;
-    fastdds::dds::xtypes::TypeObject _type_object;
+    // No lock is held while querying, as the user may take long to provide the type (e.g. reading it from disk)
+    std::unique_ptr<const unsigned char []> serialized_type;
+    uint32_t serialized_type_size = 0;
+    if (!type_query_callback_(type_name.c_str(), serialized_type, serialized_type_size))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
+                "Type query callback failed to retrieve " << type_name << " type.");
+        return false;
+    }
 
-    // Deserialize and register all dependencies and main type (last one in collection)
-    for (DynamicType& dynamic_type : dynamic_types.dynamic_types())
     {
-        if (!serialization::deserialize_dynamic_type(dynamic_type, _type_name, _type_identifier, _type_object))
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        // Register the type obtained through the type query callback
+        fastdds::dds::xtypes::TypeObject type_object;
+        if (!register_type_nts_(type_name, serialized_type.get(), serialized_type_size, type_identifier, type_object))
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                    "Failed to deserialize " << dynamic_type.type_name() << " DynamicType.");
+                    "Failed to register type " << type_name << ".");
             return false;
         }
 
+        // Add to schemas map, but do not report it to the user as it is the exact same information we obtained
+        // through the type query callback.
+        add_schema_nts_(type_identifier, type_object, false);
+    }
+
+    // Persist it, so it does not need to be queried again after a restart
+    if (type_store_)
+    {
+        type_store_->store(type_identifier, type_name, serialized_type.get(), serialized_type_size);
+    }
+
+    return true;
+}
+
+bool CBHandler::register_type_nts_(
+        const std::string& type_name,
+        const unsigned char* serialized_type,
+        uint32_t serialized_type_size,
+        fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        fastdds::dds::xtypes::TypeObject& type_object)
+{
+    if (nullptr == serialized_type || 0 == serialized_type_size)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
+                "No serialized types provided for type " << type_name << ".");
+        return false;
+    }
+
+    std::vector<serialization::DeserializedType> types;
+    if (!serialization::deserialize_types(serialized_type, serialized_type_size, types) || types.empty())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
+                "Failed to deserialize serialized types.");
+        return false;
+    }
+
+    // Register all dependencies and main type (last one)
+    for (const serialization::DeserializedType& type : types)
+    {
         // Create a TypeIdentifierPair to use in register_type_identifier
         fastdds::dds::xtypes::TypeIdentifierPair type_identifiers;
-        type_identifiers.type_identifier1(_type_identifier);
+        type_identifiers.type_identifier1(type.type_identifier);
 
         // Register in factory
         if (fastdds::dds::RETCODE_OK !=
                 fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().register_type_object(
-                    _type_object, type_identifiers))
+                    type.type_object, type_identifiers))
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                    "Failed to register " << dynamic_type.type_name() << " DynamicType.");
+                    "Failed to register " << type.type_name << " DynamicType.");
             return false;
         }
     }
 
-    if (_type_name != type_name)
+    const serialization::DeserializedType& main_type = types.back();
+    if (main_type.type_name != type_name)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
-                "Unexpected dynamic types collection format: " << type_name << " expected to be last item, found " << _type_name <<
-                " instead.");
+                "Unexpected serialized types format: " << type_name << " expected to be last item, found " <<
+                main_type.type_name << " instead.");
         return false;
     }
 
     // Assign type identifier and object after all types have been registered
-    type_identifier = _type_identifier;
-    type_object = _type_object;
+    type_identifier = main_type.type_identifier;
+    type_object = main_type.type_object;
 
     return true;
 }
 
+void CBHandler::load_type_store_nts_()
+{
+    const auto start = std::chrono::steady_clock::now();
+    unsigned int registered_types = 0;
+
+    const bool loaded = type_store_->load(
+        [this, &registered_types](
+            const std::string& type_name,
+            const unsigned char* serialized_type,
+            uint32_t serialized_type_size)
+        {
+            fastdds::dds::xtypes::TypeIdentifier type_identifier;
+            fastdds::dds::xtypes::TypeObject type_object;
+            // Add to schemas map too, so the codec is ready on first use. Not reported to the user, as persisted types
+            // were already notified (or provided through the type query callback) before being stored.
+            if (register_type_nts_(type_name, serialized_type, serialized_type_size, type_identifier, type_object) &&
+                    add_schema_nts_(type_identifier, type_object, false))
+            {
+                registered_types++;
+            }
+            else
+            {
+                EPROSIMA_LOG_WARNING(DDSENABLER_CB_HANDLER,
+                        "Failed to register type " << type_name << " from type store.");
+            }
+        });
+
+    if (!loaded)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_HANDLER,
+                "Failed to load type store " << configuration_.type_store_path << ".");
+        return;
+    }
+
+    EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
+            "Registered " << registered_types << " types from type store " << configuration_.type_store_path <<
+            " in " << std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count() << " ms.");
+}
+
 } /* namespace participants */
 } /* namespace ddsenabler */
 } /* namespace eprosima */
@@ -34,6 +34,7 @@ CBMessage::CBMessage(
     source_guid = msg.source_guid;
     sequence_number = msg.sequence_number;
     publish_time = msg.publish_time;
+    codec = msg.codec;
 }
 
 CBMessage::~CBMessage()
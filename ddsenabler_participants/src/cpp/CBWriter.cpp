@@ -16,15 +16,22 @@
  * @file CBWriter.cpp
  */
 
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
 #include <nlohmann/json.hpp>
 
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
 #include <fastdds/dds/xtypes/utils.hpp>
 #include <fastdds/rtps/common/SerializedPayload.hpp>
 #include <fastdds/rtps/common/Types.hpp>
 
+#include <ddsenabler_participants/CdrJsonTranscoder.hpp>
+#include <ddsenabler_participants/json_writer.hpp>
 #include <ddsenabler_participants/serialization.hpp>
+#include <ddsenabler_participants/TypeCodec.hpp>
 #include <ddsenabler_participants/types/dynamic_types_collection/DynamicTypesCollection.hpp>
 
 #include <ddsenabler_participants/CBWriter.hpp>
@@ -44,33 +51,40 @@ void CBWriter::write_schema(
 
     const std::string& type_name = dyn_type->get_name().to_string();
 
+    // Nothing to generate if the schema is neither notified nor persisted
+    if (!type_notification_callback_ && !type_store_)
+    {
+        return;
+    }
+
     // Schema has not been registered
     EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
             "Writing schema: " << type_name << ".");
 
-    std::stringstream ss_idl;
-    auto ret = fastdds::dds::idl_serialize(dyn_type, ss_idl);
-    if (ret != fastdds::dds::RETCODE_OK)
+    std::vector<unsigned char> serialized_types;
+    if (!serialize_types_(type_name, type_id, serialized_types))
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
-                "Failed to serialize DynamicType to idl for type with name: " << type_name);
         return;
     }
 
-    DynamicTypesCollection types_collection;
-    if (!serialize_dynamic_type(type_name, type_id, types_collection))
+    if (type_store_)
+    {
+        type_store_->store(type_id, type_name, serialized_types.data(),
+                static_cast<uint32_t>(serialized_types.size()));
+    }
+
+    // IDL and data placeholder are only generated to be notified
+    if (!type_notification_callback_)
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
-                "Failed to serialize dynamic types collection: " << type_name);
         return;
     }
 
-    std::unique_ptr<fastdds::rtps::SerializedPayload_t> types_collection_payload = serialize_dynamic_types(
-        types_collection);
-    if (nullptr == types_collection_payload)
+    std::stringstream ss_idl;
+    auto ret = fastdds::dds::idl_serialize(dyn_type, ss_idl);
+    if (ret != fastdds::dds::RETCODE_OK)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
-                "Failed to serialize dynamic types collection: " << type_name);
+                "Failed to serialize DynamicType to idl for type with name: " << type_name);
         return;
     }
 
@@ -85,17 +99,15 @@ void CBWriter::write_schema(
         return;
     }
 
-    // Notify type reception
-    if (type_notification_callback_)
-    {
-        type_notification_callback_(
-            type_name.c_str(),
-            ss_idl.str().c_str(),
-            types_collection_payload->data,
-            types_collection_payload->length,
-            ss_data_holder.str().c_str()
-            );
-    }
+    // Notify type reception (schemas may be prepared concurrently, but they are notified one at a time)
+    std::lock_guard<std::mutex> lock(schema_mtx_);
+    type_notification_callback_(
+        type_name.c_str(),
+        ss_idl.str().c_str(),
+        serialized_types.data(),
+        static_cast<uint32_t>(serialized_types.size()),
+        ss_data_holder.str().c_str()
+        );
 }
 
 void CBWriter::write_topic(
@@ -117,105 +129,309 @@ void CBWriter::write_topic(
 }
 
 void CBWriter::write_data(
-        const CBMessage& msg,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+        const CBMessage& msg)
 {
-    assert(nullptr != dyn_type);
+    assert(nullptr != msg.codec);
+
+    if (!data_notification_callback_ && !data_batcher_)
+    {
+        return;
+    }
 
     EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
             "Writing message from topic: " << msg.topic.topic_name() << ".");
 
-    // Get the dynamic data to be serialized into JSON
-    fastdds::dds::DynamicData::_ref_type dyn_data = get_dynamic_data_(msg, dyn_type);
+    const std::string& topic_name = msg.topic.topic_name();
+    const std::shared_ptr<const TopicEnvelope> envelope = get_topic_envelope_(topic_name, *msg.codec);
+
+    // Formatting buffers are kept per thread, so samples of different topics can be written concurrently
+    static thread_local DataOutput data_output;
+
+    // Build the notification {"id": <guid prefix>, "type": "fastdds", <topic>: {"data": {<instance>: <sample>},
+    // "type": <type name>}} directly in the output buffer, with the same layout as nlohmann::json::dump(4)
+    // (i.e. keys sorted and 4 spaces indentation)
+    std::string& output = data_output.buffer;
+    output.clear();
+    output.append("{\n");
+
+    bool first_entry = true;
+    for (const EnvelopeEntry entry : envelope->entries)
+    {
+        if (!first_entry)
+        {
+            output.append(",\n");
+        }
+        first_entry = false;
+        json_writer::write_indentation(output, 1);
+
+        switch (entry)
+        {
+            case EnvelopeEntry::ID:
+                output.append("\"id\": ");
+                output.append(get_guid_prefix_string_(data_output, msg.source_guid.guid_prefix()));
+                break;
+
+            case EnvelopeEntry::TYPE:
+                output.append("\"type\": \"fastdds\"");
+                break;
+
+            case EnvelopeEntry::TOPIC:
+                output.append(envelope->opening);
+                output.append(get_instance_handle_string_(data_output, msg.instanceHandle));
+                output.append(": ");
+                if (!write_sample_(msg, output))
+                {
+                    return;
+                }
+                output.append(envelope->closing);
+                break;
+        }
+    }
+    output.append("\n}");
+
+    // Notify data reception
+    if (data_notification_callback_)
+    {
+        data_notification_callback_(
+            topic_name.c_str(),
+            output.c_str(),
+            msg.publish_time.to_ns()
+            );
+    }
+
+    // The batcher copies the notification, so the buffer can be reused for the next sample
+    if (data_batcher_)
+    {
+        data_batcher_->add(
+            topic_name,
+            output.data(),
+            static_cast<uint32_t>(output.size()),
+            msg.publish_time.to_ns());
+    }
+}
+
+void CBWriter::write_raw_data(
+        const CBMessage& msg)
+{
+    if (!data_raw_notification_callback_)
+    {
+        return;
+    }
+
+    EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
+            "Writing raw message from topic: " << msg.topic.topic_name() << ".");
+
+    std::array<unsigned char, 16> instance_handle;
+    for (size_t i = 0; i < instance_handle.size(); ++i)
+    {
+        instance_handle[i] = msg.instanceHandle.value[i];
+    }
+
+    // Guid prefix (12 bytes) followed by entity id (4 bytes)
+    std::array<unsigned char, 16> source_guid;
+    for (size_t i = 0; i < fastdds::rtps::GuidPrefix_t::size; ++i)
+    {
+        source_guid[i] = msg.source_guid.guidPrefix.value[i];
+    }
+    for (size_t i = 0; i < fastdds::rtps::EntityId_t::size; ++i)
+    {
+        source_guid[fastdds::rtps::GuidPrefix_t::size + i] = msg.source_guid.entityId.value[i];
+    }
+
+    // Notify data reception, handing over the payload owned by the payload pool
+    data_raw_notification_callback_(
+        msg.topic.topic_name().c_str(),
+        msg.topic.type_name.c_str(),
+        msg.payload.data,
+        msg.payload.length,
+        msg.payload.encapsulation,
+        instance_handle.data(),
+        source_guid.data(),
+        msg.publish_time.to_ns()
+        );
+}
+
+bool CBWriter::serialize_types_(
+        const std::string& type_name,
+        const fastdds::dds::xtypes::TypeIdentifier& type_id,
+        std::vector<unsigned char>& serialized_types) const
+{
+    if (TypeFormat::TYPE_BUNDLE == type_format_)
+    {
+        if (!serialize_type_bundle(type_name, type_id, serialized_types))
+        {
+            EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
+                    "Failed to serialize type bundle: " << type_name);
+            return false;
+        }
+        return true;
+    }
+
+    DynamicTypesCollection types_collection;
+    if (!serialize_dynamic_type(type_name, type_id, types_collection))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
+                "Failed to serialize dynamic types collection: " << type_name);
+        return false;
+    }
+
+    std::unique_ptr<fastdds::rtps::SerializedPayload_t> types_collection_payload = serialize_dynamic_types(
+        types_collection);
+    if (nullptr == types_collection_payload)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
+                "Failed to serialize dynamic types collection: " << type_name);
+        return false;
+    }
+
+    serialized_types.assign(types_collection_payload->data,
+            types_collection_payload->data + types_collection_payload->length);
+    return true;
+}
+
+bool CBWriter::write_sample_(
+        const CBMessage& msg,
+        std::string& output)
+{
+    // Serialize the sample into JSON directly from CDR
+    const CdrJsonTranscoder* transcoder = msg.codec->transcoder();
+    if (nullptr != transcoder && transcoder->transcode(msg.payload, output, SAMPLE_INDENTATION_LEVEL))
+    {
+        return true;
+    }
+
+    // Fall back to DynamicData if not possible
+    fastdds::dds::DynamicData::_ref_type dyn_data = msg.codec->deserialize(msg.payload);
 
     if (nullptr == dyn_data)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
                 "Not able to get DynamicData from topic " << msg.topic.topic_name() << ".");
-        return;
+        return false;
     }
 
     std::stringstream ss_dyn_data;
     ss_dyn_data << std::setw(4);
-    if (fastdds::dds::RETCODE_OK !=
-            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss_dyn_data))
+    const bool serialized = (fastdds::dds::RETCODE_OK ==
+            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss_dyn_data));
+
+    // Give the DynamicData back for the next sample
+    msg.codec->release(std::move(dyn_data));
+
+    if (!serialized)
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
                 "Not able to serialize data of topic " << msg.topic.topic_name() << " into JSON format.");
-        return;
+        return false;
     }
 
-    // Fill JSON object with the data
-    nlohmann::json json_output;
+    // Normalize the layout (key order) of json_serialize output
+    json_writer::write_nested(output, nlohmann::json::parse(ss_dyn_data.str()).dump(4), SAMPLE_INDENTATION_LEVEL);
+
+    return true;
+}
+
+std::shared_ptr<const CBWriter::TopicEnvelope> CBWriter::get_topic_envelope_(
+        const std::string& topic_name,
+        const TypeCodec& codec)
+{
+    // Check if we already have the envelope of this topic
     {
-        // Set id to be the source guid prefix
-        std::stringstream ss_source_guid_prefix;
-        ss_source_guid_prefix << msg.source_guid.guid_prefix();
-        json_output["id"] = ss_source_guid_prefix.str();
+        std::lock_guard<std::mutex> lock(data_mtx_);
 
-        // Set type to be fastdds
-        json_output["type"] = "fastdds";
+        auto it = topic_envelopes_.find(topic_name);
+        if (it != topic_envelopes_.end() && it->second->type_name == codec.type_name())
+        {
+            return it->second;
+        }
+    }
 
-        // Insert type and data (to be filled below) with topic name as key
-        json_output[msg.topic.topic_name()] = {
-            {"type", msg.topic.type_name},
-            {"data", nlohmann::json::object()}
-        };
+    auto envelope = std::make_shared<TopicEnvelope>();
+    envelope->type_name = codec.type_name();
 
-        // Insert data with instance handle as key
-        std::stringstream ss_instanceHandle;
-        ss_instanceHandle << msg.instanceHandle;
-        json_output[msg.topic.topic_name()]["data"][ss_instanceHandle.str()] = nlohmann::json::parse(ss_dyn_data.str());
+    // Top level keys in nlohmann (sorted) order, where the topic replaces an entry with the same key
+    std::vector<std::pair<std::string, EnvelopeEntry>> keys;
+    keys.emplace_back(topic_name, EnvelopeEntry::TOPIC);
+    if (topic_name != ENVELOPE_ID_KEY)
+    {
+        keys.emplace_back(ENVELOPE_ID_KEY, EnvelopeEntry::ID);
+    }
+    if (topic_name != ENVELOPE_TYPE_KEY)
+    {
+        keys.emplace_back(ENVELOPE_TYPE_KEY, EnvelopeEntry::TYPE);
     }
+    std::sort(keys.begin(), keys.end());
 
-    // Notify data reception
-    if (data_notification_callback_)
+    envelope->entries.clear();
+    for (const auto& key : keys)
     {
-        data_notification_callback_(
-            msg.topic.topic_name().c_str(),
-            json_output.dump(4).c_str(),
-            msg.publish_time.to_ns()
-            );
+        envelope->entries.push_back(key.second);
     }
+
+    // "<topic>": {
+    //     "data": {
+    //         "<instance>": <sample>
+    //     },
+    //     "type": "<type name>"
+    // }
+    envelope->opening.clear();
+    json_writer::write_string(envelope->opening, topic_name);
+    envelope->opening.append(": {\n");
+    json_writer::write_indentation(envelope->opening, 2);
+    envelope->opening.append("\"data\": {\n");
+    json_writer::write_indentation(envelope->opening, SAMPLE_INDENTATION_LEVEL);
+
+    envelope->closing.clear();
+    envelope->closing.push_back('\n');
+    json_writer::write_indentation(envelope->closing, 2);
+    envelope->closing.append("},\n");
+    json_writer::write_indentation(envelope->closing, 2);
+    envelope->closing.append("\"type\": ");
+    envelope->closing.append(codec.type_name_json());
+    envelope->closing.push_back('\n');
+    json_writer::write_indentation(envelope->closing, 1);
+    envelope->closing.push_back('}');
+
+    std::lock_guard<std::mutex> lock(data_mtx_);
+    topic_envelopes_[topic_name] = envelope;
+
+    return envelope;
 }
 
-fastdds::dds::DynamicData::_ref_type CBWriter::get_dynamic_data_(
-        const CBMessage& msg,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept
+const std::string& CBWriter::get_guid_prefix_string_(
+        DataOutput& data_output,
+        const fastdds::rtps::GuidPrefix_t& guid_prefix)
 {
-    // TODO fast this should not be done, but dyn types API is like it is.
-    auto& data_no_const = const_cast<eprosima::fastdds::rtps::SerializedPayload_t&>(msg.payload);
-
-    // Create a DynamicData object using the DynamicType
-    fastdds::dds::DynamicData::_ref_type dyn_data(
-        fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type));
-
-    // Deserialize data into the DynamicData object
-    if (!(get_pubsub_type_(dyn_type).deserialize(data_no_const, &dyn_data)))
+    // Samples usually come in bursts from the same source, so keep the last one formatted
+    if (data_output.guid_prefix_string.empty() || guid_prefix != data_output.guid_prefix)
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_CB_WRITER,
-                "Failed to deserialize data for topic: " << msg.topic.topic_name());
-        return nullptr;
+        std::stringstream ss_source_guid_prefix;
+        ss_source_guid_prefix << guid_prefix;
+
+        data_output.guid_prefix = guid_prefix;
+        data_output.guid_prefix_string.clear();
+        json_writer::write_string(data_output.guid_prefix_string, ss_source_guid_prefix.str());
     }
 
-    return dyn_data;
+    return data_output.guid_prefix_string;
 }
 
-fastdds::dds::DynamicPubSubType CBWriter::get_pubsub_type_(
-        const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept
+const std::string& CBWriter::get_instance_handle_string_(
+        DataOutput& data_output,
+        const fastdds::rtps::InstanceHandle_t& instance_handle)
 {
-    // Check if we already have this pubsub type
-    auto it = dynamic_pubsub_types_.find(dyn_type);
-    if (it != dynamic_pubsub_types_.end())
+    // Keyless topics always use the same instance handle, so keep the last one formatted
+    if (data_output.instance_handle_string.empty() || instance_handle != data_output.instance_handle)
     {
-        return it->second;
-    }
+        std::stringstream ss_instance_handle;
+        ss_instance_handle << instance_handle;
 
-    // Create a new pubsub type
-    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
-    dynamic_pubsub_types_[dyn_type] = pubsub_type;
+        data_output.instance_handle = instance_handle;
+        data_output.instance_handle_string.clear();
+        json_writer::write_string(data_output.instance_handle_string, ss_instance_handle.str());
+    }
 
-    return pubsub_type;
+    return data_output.instance_handle_string;
 }
 
 } /* namespace participants */
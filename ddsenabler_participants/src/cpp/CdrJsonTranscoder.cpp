@@ -0,0 +1,1687 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CdrJsonTranscoder.cpp
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/Exception.h>
+#include <fastcdr/xcdr/optional.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeMember.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+#include <fastdds/dds/xtypes/type_representation/detail/dds_xtypes_typeobject.hpp>
+#include <fastdds/dds/xtypes/utils.hpp>
+
+#include <ddsenabler_participants/json_writer.hpp>
+
+#include <ddsenabler_participants/CdrJsonTranscoder.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+namespace {
+
+namespace xtypes = eprosima::fastdds::dds::xtypes;
+
+using fastdds::dds::DynamicData;
+using fastdds::dds::DynamicDataFactory;
+using fastdds::dds::DynamicType;
+using fastdds::dds::DynamicTypeMember;
+using fastdds::dds::MemberDescriptor;
+using fastdds::dds::TypeDescriptor;
+using fastdds::dds::traits;
+
+//! Error raised while building the plan or decoding a payload, reported to the caller as a \c false return value
+class TranscodingError : public std::runtime_error
+{
+public:
+
+    explicit TranscodingError(
+            const std::string& message)
+        : std::runtime_error(message)
+    {
+    }
+
+};
+
+//! Placeholder used to let Fast CDR handle the presence of optional members
+struct OptionalValue
+{
+};
+
+//! Decoding of the optional member being deserialized, run once Fast CDR finds out it is present
+struct PendingOptional
+{
+    void (* decode)(
+            fastcdr::Cdr& cdr,
+            const void* call);
+
+    const void* call;
+};
+
+thread_local const PendingOptional* pending_optional = nullptr;
+
+TypeDescriptor::_ref_type get_type_descriptor(
+        const DynamicType::_ref_type& dyn_type)
+{
+    TypeDescriptor::_ref_type descriptor {traits<TypeDescriptor>::make_shared()};
+    if (fastdds::dds::RETCODE_OK != dyn_type->get_descriptor(descriptor))
+    {
+        throw TranscodingError("Failed to get descriptor of type " + dyn_type->get_name().to_string());
+    }
+    return descriptor;
+}
+
+MemberDescriptor::_ref_type get_member_descriptor(
+        const DynamicType::_ref_type& dyn_type,
+        uint32_t index)
+{
+    DynamicTypeMember::_ref_type member;
+    MemberDescriptor::_ref_type descriptor {traits<MemberDescriptor>::make_shared()};
+    if (fastdds::dds::RETCODE_OK != dyn_type->get_member_by_index(member, index) ||
+            fastdds::dds::RETCODE_OK != member->get_descriptor(descriptor))
+    {
+        throw TranscodingError("Failed to get member " + std::to_string(index) + " of type " +
+                      dyn_type->get_name().to_string());
+    }
+    return descriptor;
+}
+
+DynamicType::_ref_type resolve_alias(
+        const DynamicType::_ref_type& dyn_type)
+{
+    DynamicType::_ref_type resolved = dyn_type;
+    while (xtypes::TK_ALIAS == resolved->get_kind())
+    {
+        resolved = get_type_descriptor(resolved)->base_type();
+    }
+    return resolved;
+}
+
+std::string format_string(
+        const std::string& value)
+{
+    std::string output;
+    if (!json_writer::write_string(output, value))
+    {
+        throw TranscodingError("Name " + value + " is not valid UTF-8");
+    }
+    return output;
+}
+
+fastcdr::EncodingAlgorithmFlag encoding_algorithm(
+        fastdds::dds::ExtensibilityKind extensibility,
+        fastcdr::Cdr& cdr)
+{
+    const bool xcdr2 = fastcdr::CdrVersion::XCDRv2 == cdr.get_cdr_version();
+
+    switch (extensibility)
+    {
+        case fastdds::dds::ExtensibilityKind::MUTABLE:
+            return xcdr2 ? fastcdr::EncodingAlgorithmFlag::PL_CDR2 : fastcdr::EncodingAlgorithmFlag::PL_CDR;
+        case fastdds::dds::ExtensibilityKind::APPENDABLE:
+            return xcdr2 ? fastcdr::EncodingAlgorithmFlag::DELIMIT_CDR2 : fastcdr::EncodingAlgorithmFlag::PLAIN_CDR;
+        case fastdds::dds::ExtensibilityKind::FINAL:
+        default:
+            return xcdr2 ? fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2 : fastcdr::EncodingAlgorithmFlag::PLAIN_CDR;
+    }
+}
+
+bool is_parameter_list(
+        fastcdr::EncodingAlgorithmFlag encoding)
+{
+    return fastcdr::EncodingAlgorithmFlag::PL_CDR == encoding || fastcdr::EncodingAlgorithmFlag::PL_CDR2 == encoding;
+}
+
+void read_dheader(
+        fastcdr::Cdr& cdr,
+        bool primitive_element)
+{
+    // XCDR2 collections of non-primitive elements are preceded by their serialized size
+    if (fastcdr::CdrVersion::XCDRv2 == cdr.get_cdr_version() && !primitive_element)
+    {
+        uint32_t dheader {0};
+        cdr.deserialize(dheader);
+    }
+}
+
+//! Bytes used to serialize a bitmask or bitset holder with the given bit bound
+uint32_t holder_size(
+        uint32_t bit_bound)
+{
+    if (bit_bound <= 8)
+    {
+        return 1;
+    }
+    else if (bit_bound <= 16)
+    {
+        return 2;
+    }
+    else if (bit_bound <= 32)
+    {
+        return 4;
+    }
+    return 8;
+}
+
+uint64_t read_holder(
+        fastcdr::Cdr& cdr,
+        uint32_t bit_bound)
+{
+    switch (holder_size(bit_bound))
+    {
+        case 1:
+        {
+            uint8_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case 2:
+        {
+            uint16_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case 4:
+        {
+            uint32_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        default:
+        {
+            uint64_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+    }
+}
+
+} /* namespace */
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+
+namespace fastcdr {
+
+template<>
+void deserialize(
+        Cdr& cdr,
+        ddsenabler::participants::OptionalValue&)
+{
+    const ddsenabler::participants::PendingOptional* pending = ddsenabler::participants::pending_optional;
+    pending->decode(cdr, pending->call);
+}
+
+} /* namespace fastcdr */
+
+namespace ddsenabler {
+namespace participants {
+
+//! Fragment of an object (key/value pair) written in the output
+struct ObjectFragment
+{
+    size_t begin;
+    size_t end;
+    uint32_t rank;
+    size_t key_begin;
+    size_t key_size;
+};
+
+//! Scratch state of a transcoding, reused across samples
+struct CdrJsonTranscoder::Context
+{
+    std::string* output {nullptr};
+
+    //! Object fragments pending to be sorted (stacked by nesting level)
+    std::vector<ObjectFragment> fragments;
+
+    //! Received members of the structures being decoded (stacked by nesting level)
+    std::vector<uint8_t> received;
+
+    //! Raw map keys (stacked by nesting level)
+    std::string keys;
+
+    std::string scratch;
+    std::string string_value;
+    std::wstring wstring_value;
+    std::string utf8_value;
+
+    void clear()
+    {
+        output = nullptr;
+        fragments.clear();
+        received.clear();
+        keys.clear();
+    }
+
+};
+
+struct CdrJsonTranscoder::StructFrame
+{
+    const Node* node;
+    uint32_t level;
+    Context* ctx;
+    size_t received_base;
+    size_t fragments_base;
+    bool parameter_list;
+};
+
+struct CdrJsonTranscoder::UnionFrame
+{
+    const Node* node;
+    uint32_t level;
+    Context* ctx;
+    bool parameter_list;
+    bool discriminator_read;
+    int32_t selected;
+    bool written;
+};
+
+std::unique_ptr<CdrJsonTranscoder> CdrJsonTranscoder::create(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    assert(nullptr != dyn_type);
+
+    const std::string type_name = dyn_type->get_name().to_string();
+
+    std::unique_ptr<CdrJsonTranscoder> transcoder(new CdrJsonTranscoder());
+    try
+    {
+        std::map<DynamicType*, uint32_t> visited;
+        transcoder->build_node_(dyn_type, visited);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
+                "Type " << type_name << " cannot be transcoded directly from CDR: " << e.what());
+        return nullptr;
+    }
+
+    if (NodeKind::STRUCTURE != transcoder->nodes_.front().kind || !transcoder->validate_(dyn_type))
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
+                "Type " << type_name << " cannot be transcoded directly from CDR.");
+        return nullptr;
+    }
+
+    return transcoder;
+}
+
+bool CdrJsonTranscoder::transcode(
+        const fastdds::rtps::SerializedPayload_t& payload,
+        std::string& output,
+        uint32_t indent_level) const
+{
+    static thread_local Context ctx;
+
+    const size_t initial_size = output.size();
+    ctx.clear();
+    ctx.output = &output;
+
+    try
+    {
+        fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.length);
+        fastcdr::Cdr deser(fastbuffer, fastcdr::Cdr::DEFAULT_ENDIAN);
+        deser.read_encapsulation();
+
+        decode_value_(deser, 0, indent_level, ctx);
+    }
+    catch (const fastcdr::exception::Exception& e)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
+                "Failed to transcode payload: " << e.what());
+        output.resize(initial_size);
+        return false;
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_WRITER,
+                "Failed to transcode payload: " << e.what());
+        output.resize(initial_size);
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t CdrJsonTranscoder::build_node_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        std::map<fastdds::dds::DynamicType*, uint32_t>& visited)
+{
+    const DynamicType::_ref_type type = resolve_alias(dyn_type);
+
+    auto it = visited.find(type.get());
+    if (it != visited.end())
+    {
+        return it->second;
+    }
+
+    // Reserve the node before visiting its members, so recursive types refer to it
+    const uint32_t index = static_cast<uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    visited[type.get()] = index;
+
+    const TypeDescriptor::_ref_type descriptor = get_type_descriptor(type);
+
+    Node node;
+    switch (type->get_kind())
+    {
+        case xtypes::TK_BOOLEAN:
+            node.kind = NodeKind::BOOLEAN;
+            break;
+        case xtypes::TK_BYTE:
+            node.kind = NodeKind::BYTE;
+            break;
+        case xtypes::TK_INT8:
+            node.kind = NodeKind::INT8;
+            break;
+        case xtypes::TK_UINT8:
+            node.kind = NodeKind::UINT8;
+            break;
+        case xtypes::TK_INT16:
+            node.kind = NodeKind::INT16;
+            break;
+        case xtypes::TK_UINT16:
+            node.kind = NodeKind::UINT16;
+            break;
+        case xtypes::TK_INT32:
+            node.kind = NodeKind::INT32;
+            break;
+        case xtypes::TK_UINT32:
+            node.kind = NodeKind::UINT32;
+            break;
+        case xtypes::TK_INT64:
+            node.kind = NodeKind::INT64;
+            break;
+        case xtypes::TK_UINT64:
+            node.kind = NodeKind::UINT64;
+            break;
+        case xtypes::TK_FLOAT32:
+            node.kind = NodeKind::FLOAT32;
+            break;
+        case xtypes::TK_FLOAT64:
+            node.kind = NodeKind::FLOAT64;
+            break;
+        case xtypes::TK_FLOAT128:
+            node.kind = NodeKind::FLOAT128;
+            break;
+        case xtypes::TK_CHAR8:
+            node.kind = NodeKind::CHAR8;
+            break;
+        case xtypes::TK_CHAR16:
+            node.kind = NodeKind::CHAR16;
+            break;
+        case xtypes::TK_STRING8:
+            node.kind = NodeKind::STRING8;
+            break;
+        case xtypes::TK_STRING16:
+            node.kind = NodeKind::STRING16;
+            break;
+
+        case xtypes::TK_ENUM:
+        {
+            node.kind = NodeKind::ENUM;
+
+            // json_serialize writes the first enumerator (in name order) holding the value
+            std::map<int64_t, std::string> names;
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member = get_member_descriptor(type, i);
+                const std::string name = member->name().to_string();
+                const int64_t value = std::stoll(member->default_value());
+
+                auto name_it = names.find(value);
+                if (name_it == names.end() || name < name_it->second)
+                {
+                    names[value] = name;
+                }
+
+                switch (resolve_alias(member->type())->get_kind())
+                {
+                    case xtypes::TK_INT8:
+                        node.literal_kind = NodeKind::INT8;
+                        break;
+                    case xtypes::TK_UINT8:
+                        node.literal_kind = NodeKind::UINT8;
+                        break;
+                    case xtypes::TK_INT16:
+                        node.literal_kind = NodeKind::INT16;
+                        break;
+                    case xtypes::TK_UINT16:
+                        node.literal_kind = NodeKind::UINT16;
+                        break;
+                    case xtypes::TK_UINT32:
+                        node.literal_kind = NodeKind::UINT32;
+                        break;
+                    default:
+                        node.literal_kind = NodeKind::INT32;
+                        break;
+                }
+            }
+
+            for (const auto& name : names)
+            {
+                node.enumerators[name.first] = format_string(name.second);
+            }
+            break;
+        }
+
+        case xtypes::TK_BITMASK:
+        {
+            node.kind = NodeKind::BITMASK;
+            if (!descriptor->bound().empty())
+            {
+                node.bit_bound = descriptor->bound().front();
+            }
+
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member = get_member_descriptor(type, i);
+                node.flags.emplace_back(member->id(), format_string(member->name().to_string()));
+            }
+            std::stable_sort(node.flags.begin(), node.flags.end(),
+                    [](const std::pair<uint32_t, std::string>& lhs, const std::pair<uint32_t, std::string>& rhs)
+                    {
+                        return lhs.first < rhs.first;
+                    });
+            break;
+        }
+
+        case xtypes::TK_BITSET:
+        {
+            node.kind = NodeKind::BITSET;
+            node.bit_bound = 0;
+
+            const auto& bitcounts = descriptor->bound();
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member_descriptor = get_member_descriptor(type, i);
+                if (i >= bitcounts.size())
+                {
+                    throw TranscodingError("Missing bitcount of bitfield " + member_descriptor->name().to_string());
+                }
+
+                Member member;
+                member.name = member_descriptor->name().to_string();
+                member.key = format_string(member.name) + ": ";
+                member.id = member_descriptor->id();
+                member.position = member_descriptor->id();
+                member.bitcount = bitcounts[i];
+                member.node = build_node_(member_descriptor->type(), visited);
+
+                switch (nodes_[member.node].kind)
+                {
+                    case NodeKind::BOOLEAN:
+                    case NodeKind::BYTE:
+                    case NodeKind::INT8:
+                    case NodeKind::UINT8:
+                    case NodeKind::INT16:
+                    case NodeKind::UINT16:
+                    case NodeKind::INT32:
+                    case NodeKind::UINT32:
+                    case NodeKind::INT64:
+                    case NodeKind::UINT64:
+                        break;
+                    default:
+                        throw TranscodingError("Unsupported holder type for bitfield " + member.name);
+                }
+
+                node.bit_bound = std::max(node.bit_bound, member.position + member.bitcount);
+                node.members.push_back(std::move(member));
+            }
+            node.empty_json = "null";
+            break;
+        }
+
+        case xtypes::TK_STRUCTURE:
+        {
+            node.kind = NodeKind::STRUCTURE;
+            node.extensibility = descriptor->extensibility_kind();
+
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member_descriptor = get_member_descriptor(type, i);
+
+                Member member;
+                member.name = member_descriptor->name().to_string();
+                member.key = format_string(member.name) + ": ";
+                member.id = member_descriptor->id();
+                member.optional = member_descriptor->is_optional();
+                member.node = build_node_(member_descriptor->type(), visited);
+
+                node.members_by_id[member.id] = static_cast<uint32_t>(node.members.size());
+                node.members.push_back(std::move(member));
+            }
+            node.empty_json = "null";
+            break;
+        }
+
+        case xtypes::TK_UNION:
+        {
+            node.kind = NodeKind::UNION;
+            node.extensibility = descriptor->extensibility_kind();
+            node.discriminator = build_node_(descriptor->discriminator_type(), visited);
+
+            switch (nodes_[node.discriminator].kind)
+            {
+                case NodeKind::STRING8:
+                case NodeKind::STRING16:
+                case NodeKind::FLOAT32:
+                case NodeKind::FLOAT64:
+                case NodeKind::FLOAT128:
+                case NodeKind::BITMASK:
+                case NodeKind::BITSET:
+                case NodeKind::STRUCTURE:
+                case NodeKind::UNION:
+                case NodeKind::SEQUENCE:
+                case NodeKind::ARRAY:
+                case NodeKind::MAP:
+                    throw TranscodingError("Unsupported discriminator type in union " + type->get_name().to_string());
+                default:
+                    break;
+            }
+
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member_descriptor = get_member_descriptor(type, i);
+
+                // Skip the discriminator, which is not labeled
+                if (member_descriptor->label().empty() && !member_descriptor->is_default_label())
+                {
+                    continue;
+                }
+
+                Member member;
+                member.name = member_descriptor->name().to_string();
+                member.key = format_string(member.name) + ": ";
+                member.id = member_descriptor->id();
+                member.labels = member_descriptor->label();
+                member.default_label = member_descriptor->is_default_label();
+                member.node = build_node_(member_descriptor->type(), visited);
+
+                node.members_by_id[member.id] = static_cast<uint32_t>(node.members.size());
+                node.members.push_back(std::move(member));
+            }
+            break;
+        }
+
+        case xtypes::TK_SEQUENCE:
+        {
+            node.kind = NodeKind::SEQUENCE;
+            node.element = build_node_(descriptor->element_type(), visited);
+            node.empty_json = "[]";
+            break;
+        }
+
+        case xtypes::TK_ARRAY:
+        {
+            node.kind = NodeKind::ARRAY;
+            node.dimensions = descriptor->bound();
+
+            // Arrays of arrays are serialized as a single flattened array
+            DynamicType::_ref_type element_type = resolve_alias(descriptor->element_type());
+            while (xtypes::TK_ARRAY == element_type->get_kind())
+            {
+                const TypeDescriptor::_ref_type element_descriptor = get_type_descriptor(element_type);
+                node.dimensions.insert(node.dimensions.end(), element_descriptor->bound().begin(),
+                        element_descriptor->bound().end());
+                element_type = resolve_alias(element_descriptor->element_type());
+            }
+
+            if (node.dimensions.empty() ||
+                    std::find(node.dimensions.begin(), node.dimensions.end(), 0u) != node.dimensions.end())
+            {
+                throw TranscodingError("Invalid array dimensions in type " + type->get_name().to_string());
+            }
+
+            node.element = build_node_(element_type, visited);
+            break;
+        }
+
+        case xtypes::TK_MAP:
+        {
+            node.kind = NodeKind::MAP;
+            node.key = build_node_(descriptor->key_element_type(), visited);
+            node.element = build_node_(descriptor->element_type(), visited);
+            node.empty_json = "{}";
+
+            switch (nodes_[node.key].kind)
+            {
+                case NodeKind::STRING8:
+                case NodeKind::INT8:
+                case NodeKind::UINT8:
+                case NodeKind::INT16:
+                case NodeKind::UINT16:
+                case NodeKind::INT32:
+                case NodeKind::UINT32:
+                case NodeKind::INT64:
+                case NodeKind::UINT64:
+                    break;
+                default:
+                    throw TranscodingError("Unsupported key type in map " + type->get_name().to_string());
+            }
+            break;
+        }
+
+        default:
+            throw TranscodingError("Unsupported kind of type " + type->get_name().to_string());
+    }
+
+    if (NodeKind::SEQUENCE == node.kind || NodeKind::ARRAY == node.kind || NodeKind::MAP == node.kind)
+    {
+        // Nodes still being built are aggregated types, so they are never primitive
+        switch (nodes_[node.element].kind)
+        {
+            case NodeKind::BOOLEAN:
+            case NodeKind::BYTE:
+            case NodeKind::INT8:
+            case NodeKind::UINT8:
+            case NodeKind::INT16:
+            case NodeKind::UINT16:
+            case NodeKind::INT32:
+            case NodeKind::UINT32:
+            case NodeKind::INT64:
+            case NodeKind::UINT64:
+            case NodeKind::FLOAT32:
+            case NodeKind::FLOAT64:
+            case NodeKind::FLOAT128:
+            case NodeKind::CHAR8:
+            case NodeKind::CHAR16:
+            case NodeKind::ENUM:
+            case NodeKind::BITMASK:
+                node.primitive_element = true;
+                break;
+            default:
+                node.primitive_element = false;
+                break;
+        }
+    }
+
+    if (NodeKind::STRUCTURE == node.kind || NodeKind::BITSET == node.kind)
+    {
+        // JSON keys are sorted by name
+        std::vector<uint32_t> order(node.members.size());
+        for (uint32_t i = 0; i < order.size(); ++i)
+        {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&node](uint32_t lhs, uint32_t rhs)
+                {
+                    return node.members[lhs].name < node.members[rhs].name;
+                });
+        for (uint32_t i = 0; i < order.size(); ++i)
+        {
+            node.members[order[i]].rank = i;
+        }
+
+        if (NodeKind::BITSET == node.kind)
+        {
+            // Bitfields are always present, so they are written directly in key order
+            std::sort(node.members.begin(), node.members.end(), [](const Member& lhs, const Member& rhs)
+                    {
+                        return lhs.rank < rhs.rank;
+                    });
+        }
+    }
+
+    nodes_[index] = std::move(node);
+
+    if (NodeKind::STRUCTURE == nodes_[index].kind)
+    {
+        calibrate_structure_(index, type);
+    }
+
+    return index;
+}
+
+void CdrJsonTranscoder::calibrate_structure_(
+        uint32_t node_index,
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    // Members missing in a payload (e.g. absent optionals or appendable types with less members) keep the value they
+    // have in a default constructed sample, so find out how json_serialize writes it
+    DynamicData::_ref_type dyn_data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+    if (nullptr == dyn_data)
+    {
+        return;
+    }
+
+    std::stringstream ss_dyn_data;
+    ss_dyn_data << std::setw(4);
+    const bool serialized = fastdds::dds::RETCODE_OK ==
+            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss_dyn_data);
+    DynamicDataFactory::get_instance()->delete_data(dyn_data);
+
+    if (!serialized)
+    {
+        return;
+    }
+
+    const nlohmann::json json = nlohmann::json::parse(ss_dyn_data.str());
+
+    Node& node = nodes_[node_index];
+    node.empty_json = json.dump(4);
+
+    if (json.is_object())
+    {
+        for (auto& member : node.members)
+        {
+            auto it = json.find(member.name);
+            if (it == json.end())
+            {
+                continue;
+            }
+
+            member.default_present = true;
+            member.default_json = it->dump(4);
+
+            // Default constructed collections are empty, which shows how empty collections are written
+            Node& member_node = nodes_[member.node];
+            if (NodeKind::SEQUENCE == member_node.kind || NodeKind::MAP == member_node.kind)
+            {
+                member_node.empty_json = member.default_json;
+            }
+        }
+    }
+
+    node.calibrated = true;
+}
+
+bool CdrJsonTranscoder::validate_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type) const
+{
+    DynamicData::_ref_type dyn_data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+    if (nullptr == dyn_data)
+    {
+        return false;
+    }
+
+    bool valid = true;
+
+    std::stringstream ss_dyn_data;
+    ss_dyn_data << std::setw(4);
+    if (fastdds::dds::RETCODE_OK !=
+            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss_dyn_data))
+    {
+        valid = false;
+    }
+
+    if (valid)
+    {
+        const std::string expected = nlohmann::json::parse(ss_dyn_data.str()).dump(4);
+
+        fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+        for (auto data_representation : {fastdds::dds::DataRepresentationId::XCDR_DATA_REPRESENTATION,
+                                         fastdds::dds::DataRepresentationId::XCDR2_DATA_REPRESENTATION})
+        {
+            fastdds::rtps::SerializedPayload_t payload(
+                pubsub_type.calculate_serialized_size(&dyn_data, data_representation));
+
+            std::string output;
+            if (!pubsub_type.serialize(&dyn_data, payload, data_representation) ||
+                    !transcode(payload, output) ||
+                    output != expected)
+            {
+                valid = false;
+                break;
+            }
+        }
+    }
+
+    DynamicDataFactory::get_instance()->delete_data(dyn_data);
+
+    return valid;
+}
+
+void CdrJsonTranscoder::decode_value_(
+        fastcdr::Cdr& cdr,
+        uint32_t node_index,
+        uint32_t level,
+        Context& ctx) const
+{
+    const Node& node = nodes_[node_index];
+    std::string& out = *ctx.output;
+
+    switch (node.kind)
+    {
+        case NodeKind::BOOLEAN:
+        {
+            bool value {false};
+            cdr.deserialize(value);
+            json_writer::write_boolean(out, value);
+            break;
+        }
+        case NodeKind::BYTE:
+        case NodeKind::UINT8:
+        {
+            uint8_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_unsigned(out, value);
+            break;
+        }
+        case NodeKind::INT8:
+        {
+            int8_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_integer(out, value);
+            break;
+        }
+        case NodeKind::INT16:
+        {
+            int16_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_integer(out, value);
+            break;
+        }
+        case NodeKind::UINT16:
+        {
+            uint16_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_unsigned(out, value);
+            break;
+        }
+        case NodeKind::INT32:
+        {
+            int32_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_integer(out, value);
+            break;
+        }
+        case NodeKind::UINT32:
+        {
+            uint32_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_unsigned(out, value);
+            break;
+        }
+        case NodeKind::INT64:
+        {
+            int64_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_integer(out, value);
+            break;
+        }
+        case NodeKind::UINT64:
+        {
+            uint64_t value {0};
+            cdr.deserialize(value);
+            json_writer::write_unsigned(out, value);
+            break;
+        }
+        case NodeKind::FLOAT32:
+        {
+            float value {0};
+            cdr.deserialize(value);
+            json_writer::write_float(out, value);
+            break;
+        }
+        case NodeKind::FLOAT64:
+        {
+            double value {0};
+            cdr.deserialize(value);
+            json_writer::write_float(out, value);
+            break;
+        }
+        case NodeKind::FLOAT128:
+        {
+            long double value {0};
+            cdr.deserialize(value);
+            json_writer::write_float(out, static_cast<double>(value));
+            break;
+        }
+        case NodeKind::CHAR8:
+        {
+            char value {0};
+            cdr.deserialize(value);
+            if (!json_writer::write_string(out, &value, 1))
+            {
+                throw TranscodingError("Character is not valid UTF-8");
+            }
+            break;
+        }
+        case NodeKind::CHAR16:
+        {
+            wchar_t value {0};
+            cdr.deserialize(value);
+            ctx.utf8_value.clear();
+            if (!json_writer::write_utf8(ctx.utf8_value, static_cast<uint32_t>(value)) ||
+                    !json_writer::write_string(out, ctx.utf8_value))
+            {
+                throw TranscodingError("Wide character cannot be encoded as UTF-8");
+            }
+            break;
+        }
+        case NodeKind::STRING8:
+        {
+            cdr.deserialize(ctx.string_value);
+            if (!json_writer::write_string(out, ctx.string_value))
+            {
+                throw TranscodingError("String is not valid UTF-8");
+            }
+            break;
+        }
+        case NodeKind::STRING16:
+        {
+            cdr.deserialize(ctx.wstring_value);
+            ctx.utf8_value.clear();
+            for (wchar_t c : ctx.wstring_value)
+            {
+                if (!json_writer::write_utf8(ctx.utf8_value, static_cast<uint32_t>(c)))
+                {
+                    throw TranscodingError("Wide string cannot be encoded as UTF-8");
+                }
+            }
+            if (!json_writer::write_string(out, ctx.utf8_value))
+            {
+                throw TranscodingError("Wide string cannot be encoded as UTF-8");
+            }
+            break;
+        }
+        case NodeKind::ENUM:
+            decode_enum_(cdr, node, level, ctx);
+            break;
+        case NodeKind::BITMASK:
+            decode_bitmask_(cdr, node, level, ctx);
+            break;
+        case NodeKind::BITSET:
+            decode_bitset_(cdr, node, level, ctx);
+            break;
+        case NodeKind::STRUCTURE:
+            decode_structure_(cdr, node, level, ctx);
+            break;
+        case NodeKind::UNION:
+            decode_union_(cdr, node, level, ctx);
+            break;
+        case NodeKind::SEQUENCE:
+            decode_sequence_(cdr, node, level, ctx);
+            break;
+        case NodeKind::ARRAY:
+            decode_array_(cdr, node, level, ctx);
+            break;
+        case NodeKind::MAP:
+            decode_map_(cdr, node, level, ctx);
+            break;
+    }
+}
+
+void CdrJsonTranscoder::decode_structure_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const size_t begin = out.size();
+    const fastcdr::EncodingAlgorithmFlag encoding = encoding_algorithm(node.extensibility, cdr);
+
+    StructFrame frame {&node, level, &ctx, ctx.received.size(), ctx.fragments.size(), is_parameter_list(encoding)};
+    ctx.received.resize(frame.received_base + node.members.size(), 0);
+
+    out.append("{\n");
+
+    StructFrame* frame_ptr = &frame;
+    cdr.deserialize_type(encoding, [this, frame_ptr](fastcdr::Cdr& dcdr, const fastcdr::MemberId& mid) -> bool
+            {
+                return decode_structure_member_(dcdr, mid.id, *frame_ptr);
+            });
+
+    // Members not found in the payload keep their default value
+    for (size_t i = 0; i < node.members.size(); ++i)
+    {
+        if (ctx.received[frame.received_base + i])
+        {
+            continue;
+        }
+
+        const Member& member = node.members[i];
+        if (!node.calibrated)
+        {
+            throw TranscodingError("Unknown default value of member " + member.name);
+        }
+        if (!member.default_present)
+        {
+            continue;
+        }
+
+        if (ctx.fragments.size() > frame.fragments_base)
+        {
+            out.append(",\n");
+        }
+        const size_t fragment_begin = out.size();
+        json_writer::write_indentation(out, level + 1);
+        out.append(member.key);
+        json_writer::write_nested(out, member.default_json, level + 1);
+        ctx.fragments.push_back({fragment_begin, out.size(), member.rank, 0, 0});
+    }
+    ctx.received.resize(frame.received_base);
+
+    close_object_(node, begin, frame.fragments_base, false, level, ctx);
+}
+
+bool CdrJsonTranscoder::decode_structure_member_(
+        fastcdr::Cdr& cdr,
+        uint32_t member_id,
+        StructFrame& frame) const
+{
+    const Node& node = *frame.node;
+    Context& ctx = *frame.ctx;
+    std::string& out = *ctx.output;
+
+    uint32_t index;
+    if (frame.parameter_list)
+    {
+        auto it = node.members_by_id.find(member_id);
+        if (it == node.members_by_id.end())
+        {
+            // Unknown member, let Fast CDR skip it
+            return false;
+        }
+        index = it->second;
+    }
+    else
+    {
+        if (member_id >= node.members.size())
+        {
+            return false;
+        }
+        index = member_id;
+    }
+
+    if (ctx.received[frame.received_base + index])
+    {
+        throw TranscodingError("Member " + node.members[index].name + " received twice");
+    }
+
+    const Member& member = node.members[index];
+
+    const size_t separator_begin = out.size();
+    if (ctx.fragments.size() > frame.fragments_base)
+    {
+        out.append(",\n");
+    }
+    const size_t fragment_begin = out.size();
+    json_writer::write_indentation(out, frame.level + 1);
+    out.append(member.key);
+
+    if (member.optional)
+    {
+        // Let Fast CDR find out whether the optional member is present, and decode it only in that case
+        struct OptionalCall
+        {
+            const CdrJsonTranscoder* transcoder;
+            uint32_t node;
+            uint32_t level;
+            Context* ctx;
+        }
+        call {this, member.node, frame.level + 1, &ctx};
+
+        PendingOptional pending {
+            [](fastcdr::Cdr& optional_cdr, const void* optional_call)
+            {
+                const OptionalCall* c = static_cast<const OptionalCall*>(optional_call);
+                c->transcoder->decode_value_(optional_cdr, c->node, c->level, *c->ctx);
+            },
+            &call};
+
+        const PendingOptional* previous_pending = pending_optional;
+        pending_optional = &pending;
+
+        fastcdr::optional<OptionalValue> value;
+        try
+        {
+            cdr >> value;
+        }
+        catch (...)
+        {
+            pending_optional = previous_pending;
+            throw;
+        }
+        pending_optional = previous_pending;
+
+        if (!value.has_value())
+        {
+            // Absent optionals are written as in a default constructed sample
+            out.resize(separator_begin);
+            return true;
+        }
+    }
+    else
+    {
+        decode_value_(cdr, member.node, frame.level + 1, ctx);
+    }
+
+    ctx.received[frame.received_base + index] = 1;
+    ctx.fragments.push_back({fragment_begin, out.size(), member.rank, 0, 0});
+
+    return true;
+}
+
+void CdrJsonTranscoder::decode_union_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    const fastcdr::EncodingAlgorithmFlag encoding = encoding_algorithm(node.extensibility, cdr);
+
+    UnionFrame frame {&node, level, &ctx, is_parameter_list(encoding), false, -1, false};
+
+    UnionFrame* frame_ptr = &frame;
+    cdr.deserialize_type(encoding, [this, frame_ptr](fastcdr::Cdr& dcdr, const fastcdr::MemberId& mid) -> bool
+            {
+                return decode_union_member_(dcdr, mid.id, *frame_ptr);
+            });
+
+    if (!frame.written)
+    {
+        throw TranscodingError("No member selected in union");
+    }
+}
+
+bool CdrJsonTranscoder::decode_union_member_(
+        fastcdr::Cdr& cdr,
+        uint32_t member_id,
+        UnionFrame& frame) const
+{
+    const Node& node = *frame.node;
+
+    if (!frame.discriminator_read)
+    {
+        const int64_t discriminator = read_integral_(cdr, nodes_[node.discriminator]);
+        frame.discriminator_read = true;
+
+        int32_t default_member = -1;
+        for (size_t i = 0; i < node.members.size() && frame.selected < 0; ++i)
+        {
+            const Member& member = node.members[i];
+            for (int32_t label : member.labels)
+            {
+                if (static_cast<int64_t>(label) == discriminator)
+                {
+                    frame.selected = static_cast<int32_t>(i);
+                    break;
+                }
+            }
+            if (member.default_label)
+            {
+                default_member = static_cast<int32_t>(i);
+            }
+        }
+        if (frame.selected < 0)
+        {
+            frame.selected = default_member;
+        }
+
+        // With plain encodings, stop if there is no member to read
+        return frame.parameter_list || frame.selected >= 0;
+    }
+
+    if (frame.selected < 0 || frame.written)
+    {
+        return false;
+    }
+
+    const Member& member = node.members[frame.selected];
+    if (frame.parameter_list && member_id != member.id)
+    {
+        return false;
+    }
+
+    std::string& out = *frame.ctx->output;
+    out.append("{\n");
+    json_writer::write_indentation(out, frame.level + 1);
+    out.append(member.key);
+    decode_value_(cdr, member.node, frame.level + 1, *frame.ctx);
+    out.push_back('\n');
+    json_writer::write_indentation(out, frame.level);
+    out.push_back('}');
+    frame.written = true;
+
+    return frame.parameter_list;
+}
+
+void CdrJsonTranscoder::decode_bitset_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const uint64_t holder = read_holder(cdr, node.bit_bound);
+
+    if (node.members.empty())
+    {
+        json_writer::write_nested(out, node.empty_json, level);
+        return;
+    }
+
+    // Members are already sorted by name
+    out.append("{\n");
+    for (size_t i = 0; i < node.members.size(); ++i)
+    {
+        const Member& member = node.members[i];
+        if (i > 0)
+        {
+            out.append(",\n");
+        }
+        json_writer::write_indentation(out, level + 1);
+        out.append(member.key);
+
+        const uint64_t mask = member.bitcount >= 64 ? ~0ull : ((1ull << member.bitcount) - 1);
+        const uint64_t value = (holder >> member.position) & mask;
+
+        switch (nodes_[member.node].kind)
+        {
+            case NodeKind::BOOLEAN:
+                json_writer::write_boolean(out, 0 != value);
+                break;
+            case NodeKind::INT8:
+                json_writer::write_integer(out, static_cast<int8_t>(value));
+                break;
+            case NodeKind::INT16:
+                json_writer::write_integer(out, static_cast<int16_t>(value));
+                break;
+            case NodeKind::INT32:
+                json_writer::write_integer(out, static_cast<int32_t>(value));
+                break;
+            case NodeKind::INT64:
+                json_writer::write_integer(out, static_cast<int64_t>(value));
+                break;
+            default:
+                json_writer::write_unsigned(out, value);
+                break;
+        }
+    }
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back('}');
+}
+
+void CdrJsonTranscoder::decode_enum_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const int64_t value = read_integral_(cdr, node);
+
+    auto it = node.enumerators.find(value);
+    if (it == node.enumerators.end())
+    {
+        throw TranscodingError("Unknown enumerator value " + std::to_string(value));
+    }
+
+    out.append("{\n");
+    json_writer::write_indentation(out, level + 1);
+    out.append("\"name\": ");
+    out.append(it->second);
+    out.append(",\n");
+    json_writer::write_indentation(out, level + 1);
+    out.append("\"value\": ");
+    json_writer::write_integer(out, static_cast<int32_t>(value));
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back('}');
+}
+
+void CdrJsonTranscoder::decode_bitmask_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const uint64_t value = read_holder(cdr, node.bit_bound);
+
+    out.append("{\n");
+
+    // Active flags
+    json_writer::write_indentation(out, level + 1);
+    out.append("\"active\": [");
+    bool any_active = false;
+    for (const auto& flag : node.flags)
+    {
+        if (flag.first < 64 && (value & (1ull << flag.first)))
+        {
+            out.append(any_active ? ",\n" : "\n");
+            json_writer::write_indentation(out, level + 2);
+            out.append(flag.second);
+            any_active = true;
+        }
+    }
+    if (any_active)
+    {
+        out.push_back('\n');
+        json_writer::write_indentation(out, level + 1);
+    }
+    out.append("],\n");
+
+    // Binary representation, most significant bit first
+    json_writer::write_indentation(out, level + 1);
+    out.append("\"binary\": \"");
+    const uint32_t bits = std::min<uint32_t>(node.bit_bound, 64);
+    for (uint32_t i = bits; i > 0; --i)
+    {
+        out.push_back((value & (1ull << (i - 1))) ? '1' : '0');
+    }
+    out.append("\",\n");
+
+    json_writer::write_indentation(out, level + 1);
+    out.append("\"value\": ");
+    json_writer::write_unsigned(out, value);
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back('}');
+}
+
+void CdrJsonTranscoder::decode_sequence_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+
+    read_dheader(cdr, node.primitive_element);
+    uint32_t length {0};
+    cdr.deserialize(length);
+
+    if (0 == length)
+    {
+        json_writer::write_nested(out, node.empty_json, level);
+        return;
+    }
+
+    out.push_back('[');
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        out.append(i > 0 ? ",\n" : "\n");
+        json_writer::write_indentation(out, level + 1);
+        decode_value_(cdr, node.element, level + 1, ctx);
+    }
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back(']');
+}
+
+void CdrJsonTranscoder::decode_array_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    read_dheader(cdr, node.primitive_element);
+    decode_array_dimension_(cdr, node, 0, level, ctx);
+}
+
+void CdrJsonTranscoder::decode_array_dimension_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        size_t dimension,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const bool innermost = dimension + 1 == node.dimensions.size();
+
+    out.push_back('[');
+    for (uint32_t i = 0; i < node.dimensions[dimension]; ++i)
+    {
+        out.append(i > 0 ? ",\n" : "\n");
+        json_writer::write_indentation(out, level + 1);
+        if (innermost)
+        {
+            decode_value_(cdr, node.element, level + 1, ctx);
+        }
+        else
+        {
+            decode_array_dimension_(cdr, node, dimension + 1, level + 1, ctx);
+        }
+    }
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back(']');
+}
+
+void CdrJsonTranscoder::decode_map_(
+        fastcdr::Cdr& cdr,
+        const Node& node,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    const Node& key_node = nodes_[node.key];
+
+    read_dheader(cdr, node.primitive_element);
+    uint32_t length {0};
+    cdr.deserialize(length);
+
+    const size_t begin = out.size();
+    const size_t fragments_base = ctx.fragments.size();
+    const size_t keys_base = ctx.keys.size();
+
+    out.append("{\n");
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        if (i > 0)
+        {
+            out.append(",\n");
+        }
+        const size_t fragment_begin = out.size();
+        json_writer::write_indentation(out, level + 1);
+
+        // Keys are written as strings
+        const size_t key_begin = ctx.keys.size();
+        if (NodeKind::STRING8 == key_node.kind)
+        {
+            cdr.deserialize(ctx.string_value);
+            ctx.keys.append(ctx.string_value);
+        }
+        else if (NodeKind::UINT64 == key_node.kind)
+        {
+            uint64_t key {0};
+            cdr.deserialize(key);
+            json_writer::write_unsigned(ctx.keys, key);
+        }
+        else
+        {
+            json_writer::write_integer(ctx.keys, read_integral_(cdr, key_node));
+        }
+        if (!json_writer::write_string(out, ctx.keys.data() + key_begin, ctx.keys.size() - key_begin))
+        {
+            throw TranscodingError("Map key is not valid UTF-8");
+        }
+        out.append(": ");
+
+        decode_value_(cdr, node.element, level + 1, ctx);
+        ctx.fragments.push_back({fragment_begin, out.size(), 0, key_begin, ctx.keys.size() - key_begin});
+    }
+
+    close_object_(node, begin, fragments_base, true, level, ctx);
+    ctx.keys.resize(keys_base);
+}
+
+int64_t CdrJsonTranscoder::read_integral_(
+        fastcdr::Cdr& cdr,
+        const Node& node) const
+{
+    NodeKind kind = node.kind;
+    if (NodeKind::ENUM == kind)
+    {
+        kind = node.literal_kind;
+    }
+
+    switch (kind)
+    {
+        case NodeKind::BOOLEAN:
+        {
+            bool value {false};
+            cdr.deserialize(value);
+            return value ? 1 : 0;
+        }
+        case NodeKind::BYTE:
+        case NodeKind::UINT8:
+        {
+            uint8_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::INT8:
+        {
+            int8_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::CHAR8:
+        {
+            char value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::INT16:
+        {
+            int16_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::UINT16:
+        {
+            uint16_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::CHAR16:
+        {
+            wchar_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::INT32:
+        {
+            int32_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::UINT32:
+        {
+            uint32_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::INT64:
+        {
+            int64_t value {0};
+            cdr.deserialize(value);
+            return value;
+        }
+        case NodeKind::UINT64:
+        {
+            uint64_t value {0};
+            cdr.deserialize(value);
+            return static_cast<int64_t>(value);
+        }
+        default:
+            throw TranscodingError("Value is not integral");
+    }
+}
+
+void CdrJsonTranscoder::close_object_(
+        const Node& node,
+        size_t begin,
+        size_t fragments_base,
+        bool keyed_by_name,
+        uint32_t level,
+        Context& ctx) const
+{
+    std::string& out = *ctx.output;
+    auto first = ctx.fragments.begin() + fragments_base;
+    auto last = ctx.fragments.end();
+
+    if (first == last)
+    {
+        out.resize(begin);
+        json_writer::write_nested(out, node.empty_json, level);
+        return;
+    }
+
+    auto key_of = [&ctx](const ObjectFragment& fragment)
+            {
+                return std::string_view(ctx.keys.data() + fragment.key_begin, fragment.key_size);
+            };
+    auto before = [&](const ObjectFragment& lhs, const ObjectFragment& rhs)
+            {
+                return keyed_by_name ? key_of(lhs) < key_of(rhs) : lhs.rank < rhs.rank;
+            };
+
+    // Fragments were written in serialization order, rewrite them if that is not the key order
+    bool sorted = true;
+    for (auto it = first + 1; it != last && sorted; ++it)
+    {
+        sorted = before(*(it - 1), *it);
+    }
+
+    if (!sorted)
+    {
+        std::stable_sort(first, last, before);
+
+        ctx.scratch.assign(out, begin, std::string::npos);
+        out.resize(begin);
+        out.append("{\n");
+
+        bool first_written = true;
+        for (auto it = first; it != last; ++it)
+        {
+            // Repeated map keys keep the last value
+            if (keyed_by_name && (it + 1) != last && !before(*it, *(it + 1)))
+            {
+                continue;
+            }
+            if (!first_written)
+            {
+                out.append(",\n");
+            }
+            out.append(ctx.scratch, it->begin - begin, it->end - it->begin);
+            first_written = false;
+        }
+    }
+
+    out.push_back('\n');
+    json_writer::write_indentation(out, level);
+    out.push_back('}');
+
+    ctx.fragments.resize(fragments_base);
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
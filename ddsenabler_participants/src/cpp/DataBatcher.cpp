@@ -0,0 +1,172 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DataBatcher.cpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <ddsenabler_participants/DataBatcher.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+DataBatcher::DataBatcher(
+        uint32_t max_samples,
+        uint32_t max_bytes,
+        std::chrono::milliseconds max_latency,
+        DdsDataBatchNotification callback)
+    : max_samples_(std::max<uint32_t>(max_samples, 1u))
+    , max_bytes_(max_bytes)
+    , max_latency_(max_latency)
+    , callback_(callback)
+{
+    assert(nullptr != callback_);
+
+    current_.entries.reserve(max_samples_);
+    current_.records.reserve(max_samples_);
+    spare_.entries.reserve(max_samples_);
+    spare_.records.reserve(max_samples_);
+
+    timer_ = std::thread(&DataBatcher::timer_routine_, this);
+}
+
+DataBatcher::~DataBatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    timer_.join();
+
+    flush();
+}
+
+void DataBatcher::add(
+        const std::string& topic_name,
+        const char* json,
+        uint32_t json_size,
+        int64_t publish_time)
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    const bool first = current_.empty();
+
+    // Store both texts null terminated, so they can be handed to the callback as C strings
+    Entry entry;
+    entry.topic_name_offset = current_.arena.size();
+    current_.arena.insert(current_.arena.end(), topic_name.c_str(), topic_name.c_str() + topic_name.size() + 1);
+    entry.json_offset = current_.arena.size();
+    current_.arena.insert(current_.arena.end(), json, json + json_size);
+    current_.arena.push_back('\0');
+    entry.json_size = json_size;
+    entry.publish_time = publish_time;
+    current_.entries.push_back(entry);
+
+    if (current_.entries.size() >= max_samples_ || current_.arena.size() >= max_bytes_)
+    {
+        // Respect the lock order, the batch may be delivered by someone else meanwhile
+        lock.unlock();
+        std::lock_guard<std::mutex> flush_lock(flush_mtx_);
+        lock.lock();
+
+        if (current_.entries.size() >= max_samples_ || current_.arena.size() >= max_bytes_)
+        {
+            deliver_nts_(lock);
+        }
+        return;
+    }
+
+    if (first)
+    {
+        current_.deadline = std::chrono::steady_clock::now() + max_latency_;
+        lock.unlock();
+        cv_.notify_all();
+    }
+}
+
+void DataBatcher::flush()
+{
+    std::lock_guard<std::mutex> flush_lock(flush_mtx_);
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    if (!current_.empty())
+    {
+        deliver_nts_(lock);
+    }
+}
+
+void DataBatcher::deliver_nts_(
+        std::unique_lock<std::mutex>& lock)
+{
+    // The spare batch is only used here, so it is always empty (and keeps its capacity) at this point
+    std::swap(current_, spare_);
+    lock.unlock();
+
+    // The arena does not change anymore, so pointers to it can be built now
+    Batch& batch = spare_;
+    for (const Entry& entry : batch.entries)
+    {
+        DdsDataRecord record;
+        record.topic_name = batch.arena.data() + entry.topic_name_offset;
+        record.json = batch.arena.data() + entry.json_offset;
+        record.json_size = entry.json_size;
+        record.publish_time = entry.publish_time;
+        batch.records.push_back(record);
+    }
+
+    callback_(batch.records.data(), static_cast<uint32_t>(batch.records.size()));
+
+    batch.clear();
+    lock.lock();
+}
+
+void DataBatcher::timer_routine_()
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    while (!stop_)
+    {
+        if (current_.empty())
+        {
+            cv_.wait(lock);
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() < current_.deadline)
+        {
+            cv_.wait_until(lock, current_.deadline);
+            continue;
+        }
+
+        // Respect the lock order, the batch may be delivered (and a new one started) by someone else meanwhile
+        lock.unlock();
+        std::lock_guard<std::mutex> flush_lock(flush_mtx_);
+        lock.lock();
+
+        if (!current_.empty() && std::chrono::steady_clock::now() >= current_.deadline)
+        {
+            deliver_nts_(lock);
+        }
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
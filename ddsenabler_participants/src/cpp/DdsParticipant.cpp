@@ -16,9 +16,14 @@
  * @file DdsParticipant.cpp
  */
 
+#include <fastdds/rtps/common/MatchingInfo.hpp>
+#include <fastdds/rtps/writer/RTPSWriter.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 #include <ddspipe_core/types/dynamic_types/types.hpp>
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+#include <ddspipe_participants/writer/rtps/SimpleWriter.hpp>
 
 #include <ddsenabler_participants/DdsParticipant.hpp>
 
@@ -30,11 +35,60 @@ using namespace eprosima::ddspipe::core;
 using namespace eprosima::ddspipe::core::types;
 using namespace eprosima::ddspipe::participants;
 
+namespace {
+
+/**
+ * Writer reporting the external readers it matches to a \c WriterMatchTracker .
+ */
+class MatchTrackingWriter : public rtps::SimpleWriter
+{
+public:
+
+    MatchTrackingWriter(
+            const ParticipantId& participant_id,
+            const DdsTopic& topic,
+            const std::shared_ptr<PayloadPool>& payload_pool,
+            fastdds::rtps::RTPSParticipant* rtps_participant,
+            bool repeater,
+            std::shared_ptr<WriterMatchTracker> match_tracker)
+        : rtps::SimpleWriter(participant_id, topic, payload_pool, rtps_participant, repeater)
+        , topic_name_(topic.m_topic_name)
+        , match_tracker_(std::move(match_tracker))
+    {
+    }
+
+    void on_writer_matched(
+            fastdds::rtps::RTPSWriter* writer,
+            const fastdds::rtps::MatchingInfo& info) noexcept override
+    {
+        rtps::SimpleWriter::on_writer_matched(writer, info);
+
+        // Ignore the readers of this participant (e.g. the one the pipe creates in this topic), as ddspipe does
+        if (info.remoteEndpointGuid.guidPrefix == writer->getGuid().guidPrefix)
+        {
+            return;
+        }
+
+        match_tracker_->on_writer_matched(topic_name_, writer->getGuid(),
+                fastdds::rtps::MATCHED_MATCHING == info.status);
+    }
+
+protected:
+
+    const std::string topic_name_;
+
+    const std::shared_ptr<WriterMatchTracker> match_tracker_;
+};
+
+} /* namespace */
+
 DdsParticipant::DdsParticipant(
         std::shared_ptr<SimpleParticipantConfiguration> participant_configuration,
         std::shared_ptr<PayloadPool> payload_pool,
-        std::shared_ptr<DiscoveryDatabase> discovery_database)
+        std::shared_ptr<DiscoveryDatabase> discovery_database,
+        std::shared_ptr<WriterMatchTracker> match_tracker)
     : DynTypesParticipant(participant_configuration, payload_pool, discovery_database)
+    , match_tracker_(std::move(match_tracker))
 {
 }
 
@@ -45,6 +99,20 @@ std::shared_ptr<IWriter> DdsParticipant::create_writer(
     {
         return std::make_shared<BlankWriter>();
     }
+
+    // Track the readers matched by plain RTPS writers (those with partitions or ownership are not tracked, so the
+    // first publication in their topics waits for the whole initial publish wait)
+    const DdsTopic* dds_topic = dynamic_cast<const DdsTopic*>(&topic);
+    if (match_tracker_ && nullptr != dds_topic &&
+            INTERNAL_TOPIC_TYPE_RTPS == dds_topic->internal_type_discriminator() &&
+            !dds_topic->topic_qos.has_partitions() && !dds_topic->topic_qos.has_ownership())
+    {
+        auto writer = std::make_shared<MatchTrackingWriter>(id(), *dds_topic, payload_pool_, rtps_participant_,
+                        configuration_->is_repeater, match_tracker_);
+        writer->init();
+        return writer;
+    }
+
     return rtps::SimpleParticipant::create_writer(topic);
 }
 
@@ -0,0 +1,253 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeliveryQueue.cpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <cpp_utils/utils.hpp>
+
+#include <ddsenabler_participants/DeliveryQueue.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+DeliveryQueue::DeliveryQueue(
+        unsigned int size,
+        DeliveryPolicy policy,
+        unsigned int n_threads,
+        DeliveryFunction deliver,
+        const std::set<std::string>& coalesced_topics)
+    : size_(std::max(size, 1u))
+    , policy_(policy)
+    , deliver_(std::move(deliver))
+    , coalesced_topics_(coalesced_topics)
+{
+    assert(deliver_);
+
+    for (unsigned int i = 0; i < std::max(n_threads, 1u); ++i)
+    {
+        delivery_threads_.emplace_back(&DeliveryQueue::delivery_routine_, this);
+    }
+}
+
+DeliveryQueue::~DeliveryQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_ = true;
+    }
+    ready_cv_.notify_all();
+    space_cv_.notify_all();
+
+    for (std::thread& thread : delivery_threads_)
+    {
+        thread.join();
+    }
+}
+
+void DeliveryQueue::push(
+        std::unique_ptr<CBMessage>&& msg)
+{
+    // Declared before the lock, so discarded samples release their payloads once the lock is released
+    std::unique_ptr<CBMessage> discarded;
+
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    TopicQueue& queue = get_topic_queue_nts_(msg->topic.topic_name());
+
+    if (queue.coalesced)
+    {
+        auto pending = queue.pending_instances.find(msg->instanceHandle);
+        if (pending != queue.pending_instances.end())
+        {
+            // Overwrite the pending sample in place, so instances keep their relative order
+            discarded = std::move(*pending->second);
+            *pending->second = std::move(msg);
+            queue.coalesced_samples++;
+            return;
+        }
+    }
+
+    if (queue.samples.size() >= size_)
+    {
+        switch (policy_)
+        {
+            case DeliveryPolicy::BLOCK:
+                space_cv_.wait(lock, [&]()
+                        {
+                            return stop_ || queue.samples.size() < size_;
+                        });
+                if (stop_)
+                {
+                    return;
+                }
+                break;
+
+            case DeliveryPolicy::DROP_OLDEST:
+                discarded = pop_nts_(queue);
+                queue.dropped++;
+                break;
+
+            case DeliveryPolicy::DROP_NEWEST:
+                discarded = std::move(msg);
+                queue.dropped++;
+                return;
+
+            case DeliveryPolicy::KEEP_LAST_PER_INSTANCE:
+            {
+                auto pending = std::find_if(queue.samples.begin(), queue.samples.end(),
+                                [&](const std::unique_ptr<CBMessage>& sample)
+                                {
+                                    return sample->instanceHandle == msg->instanceHandle;
+                                });
+
+                // Take the place of the pending sample, so instances keep their relative order
+                if (pending != queue.samples.end())
+                {
+                    discarded = std::move(*pending);
+                    *pending = std::move(msg);
+                    queue.coalesced_samples++;
+                    return;
+                }
+
+                discarded = pop_nts_(queue);
+                queue.dropped++;
+                break;
+            }
+        }
+    }
+
+    queue.samples.push_back(std::move(msg));
+    if (queue.coalesced)
+    {
+        queue.pending_instances[queue.samples.back()->instanceHandle] = &queue.samples.back();
+    }
+
+    if (!queue.scheduled)
+    {
+        queue.scheduled = true;
+        ready_queues_.push_back(&queue);
+        lock.unlock();
+        ready_cv_.notify_one();
+    }
+}
+
+bool DeliveryQueue::get_statistics(
+        const std::string& topic_name,
+        DeliveryQueueStatistics& statistics) const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    auto it = topic_queues_.find(topic_name);
+    if (it == topic_queues_.end())
+    {
+        return false;
+    }
+
+    statistics.depth = it->second.samples.size();
+    statistics.dropped = it->second.dropped;
+    statistics.coalesced = it->second.coalesced_samples;
+    return true;
+}
+
+DeliveryQueue::TopicQueue& DeliveryQueue::get_topic_queue_nts_(
+        const std::string& topic_name)
+{
+    auto it = topic_queues_.find(topic_name);
+    if (it != topic_queues_.end())
+    {
+        return it->second;
+    }
+
+    TopicQueue& queue = topic_queues_[topic_name];
+    queue.coalesced = std::any_of(coalesced_topics_.begin(), coalesced_topics_.end(),
+                    [&](const std::string& pattern)
+                    {
+                        return utils::match_pattern(pattern, topic_name);
+                    });
+
+    return queue;
+}
+
+std::unique_ptr<CBMessage> DeliveryQueue::pop_nts_(
+        TopicQueue& queue)
+{
+    if (queue.coalesced)
+    {
+        // The instance may have a newer pending sample if pushed while a blocked push was waiting
+        auto pending = queue.pending_instances.find(queue.samples.front()->instanceHandle);
+        if (pending != queue.pending_instances.end() && pending->second == &queue.samples.front())
+        {
+            queue.pending_instances.erase(pending);
+        }
+    }
+
+    std::unique_ptr<CBMessage> msg = std::move(queue.samples.front());
+    queue.samples.pop_front();
+
+    return msg;
+}
+
+void DeliveryQueue::delivery_routine_()
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    while (true)
+    {
+        ready_cv_.wait(lock, [&]()
+                {
+                    return stop_ || !ready_queues_.empty();
+                });
+
+        if (stop_)
+        {
+            return;
+        }
+
+        // The queue remains scheduled while being delivered, so no other thread takes samples from it meanwhile
+        TopicQueue* queue = ready_queues_.front();
+        ready_queues_.pop_front();
+
+        std::unique_ptr<CBMessage> msg = pop_nts_(*queue);
+
+        lock.unlock();
+        space_cv_.notify_all();
+
+        deliver_(*msg);
+        msg.reset();
+
+        lock.lock();
+
+        // Serve the rest of the queue after the other ready ones, so every topic progresses
+        if (queue->samples.empty())
+        {
+            queue->scheduled = false;
+        }
+        else
+        {
+            ready_queues_.push_back(queue);
+            ready_cv_.notify_one();
+        }
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -16,6 +16,13 @@
  * @file EnablerParticipant.cpp
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 #include <ddspipe_core/types/dds/Payload.hpp>
 #include <ddspipe_core/types/dynamic_types/types.hpp>
@@ -35,14 +42,103 @@ using namespace eprosima::ddspipe::core;
 using namespace eprosima::ddspipe::core::types;
 using namespace eprosima::ddspipe::participants;
 
+namespace {
+
+//! Size of the encapsulation header preceding every serialized sample
+constexpr uint32_t ENCAPSULATION_SIZE = 4;
+
+/**
+ * Check a serialized sample starts with a known encapsulation header, consistent with the given encapsulation, and
+ * does not exceed the maximum serialized size of its type (if bounded).
+ */
+bool validate_serialized_sample(
+        const TopicHandle& handle,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation)
+{
+    if (serialized_data_size < ENCAPSULATION_SIZE)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data in topic " << handle.topic_name << " : missing encapsulation.");
+        return false;
+    }
+
+    // Representation identifier (big endian), whose least significant bit is the endianness:
+    // CDR (0x0000/0x0001), PL_CDR (0x0002/0x0003), CDR2 (0x0006/0x0007), D_CDR2 (0x0008/0x0009), PL_CDR2 (0x000a/0x000b)
+    const uint16_t representation = static_cast<uint16_t>((serialized_data[0] << 8) | serialized_data[1]);
+    if (representation > 0x000b || 0x0004 == (representation & 0xfffe))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data in topic " << handle.topic_name << " : unknown encapsulation " <<
+                representation << ".");
+        return false;
+    }
+
+    if ((representation & 0x0001) != (encapsulation & 0x0001))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data in topic " << handle.topic_name <<
+                " : endianness does not match the encapsulation header.");
+        return false;
+    }
+
+    if (handle.codec->is_bounded() && serialized_data_size > handle.codec->max_serialized_size())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data in topic " << handle.topic_name << " : size " <<
+                serialized_data_size << " exceeds the maximum of type " << handle.type_name << ".");
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace */
+
 EnablerParticipant::EnablerParticipant(
         std::shared_ptr<EnablerParticipantConfiguration> participant_configuration,
         std::shared_ptr<PayloadPool> payload_pool,
         std::shared_ptr<DiscoveryDatabase> discovery_database,
-        std::shared_ptr<ISchemaHandler> schema_handler)
+        std::shared_ptr<ISchemaHandler> schema_handler,
+        std::shared_ptr<WriterMatchTracker> match_tracker,
+        std::shared_ptr<utils::SlotThreadPool> thread_pool)
     : ddspipe::participants::SchemaParticipant(participant_configuration, payload_pool, discovery_database,
             schema_handler)
+    , match_tracker_(std::move(match_tracker))
+    , thread_pool_(std::move(thread_pool))
+    , serialization_queue_(std::make_shared<SerializationQueue>())
 {
+    if (thread_pool_)
+    {
+        // Every emission runs one pending chunk (if any is left, as the publishing thread runs them as well)
+        serialization_task_id_ = utils::new_unique_task_id();
+        thread_pool_->register_slot(serialization_task_id_, [queue = serialization_queue_]()
+                {
+                    queue->run_next();
+                });
+    }
+}
+
+EnablerParticipant::~EnablerParticipant()
+{
+    // Wake up every thread waiting for a topic, and wait for the ongoing resolutions to fail their queued samples
+    std::list<Resolution> resolutions;
+    {
+        std::lock_guard<std::mutex> lck(mtx_);
+        stop_ = true;
+        resolutions.swap(resolutions_);
+    }
+    cv_.notify_all();
+    if (match_tracker_)
+    {
+        match_tracker_->interrupt_waits();
+    }
+
+    for (Resolution& resolution : resolutions)
+    {
+        resolution.thread.join();
+    }
 }
 
 std::shared_ptr<IReader> EnablerParticipant::create_reader(
@@ -53,141 +149,640 @@ std::shared_ptr<IReader> EnablerParticipant::create_reader(
         return std::make_shared<BlankReader>();
     }
 
+    auto dds_topic = dynamic_cast<const DdsTopic&>(topic);
     std::shared_ptr<InternalReader> reader;
     {
         std::lock_guard<std::mutex> lck(mtx_);
         reader = std::make_shared<InternalReader>(id());
-        auto dds_topic = dynamic_cast<const DdsTopic&>(topic);
-        readers_[dds_topic] = reader;
-        // Only notify the discovery of topics that do not originate from a topic query callback
-        if (dds_topic.topic_discoverer() != this->id())
-        {
-            std::static_pointer_cast<CBHandler>(schema_handler_)->add_topic(dds_topic);
-        }
+        auto it = readers_.insert_or_assign(dds_topic, reader).first;
+        readers_by_name_.emplace(dds_topic.m_topic_name, it);
     }
     cv_.notify_all();
+
+    // Only notify the discovery of topics that do not originate from a topic query callback. Notified without holding
+    // the mutex, as it may wait for the notification of the topic type schema.
+    if (dds_topic.topic_discoverer() != this->id())
+    {
+        std::static_pointer_cast<CBHandler>(schema_handler_)->add_topic(dds_topic);
+    }
+
     return reader;
 }
 
-bool EnablerParticipant::publish(
+bool EnablerParticipant::resolve_topic(
         const std::string& topic_name,
-        const std::string& json)
+        TopicHandle& handle)
 {
     if (topic_name.empty())
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                "Failed to publish data: topic name is empty.");
+                "Failed to resolve topic: topic name is empty.");
         return false;
     }
 
-    std::unique_lock<std::mutex> lck(mtx_);
-
     std::string type_name;
-    auto reader = lookup_reader_nts_(topic_name, type_name);
+    std::shared_ptr<InternalReader> reader;
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+
+        // Wait for the topic to be created if another thread is creating it
+        cv_.wait(lck, [&]
+                {
+                    return stop_ || 0 == creating_topics_.count(topic_name);
+                });
+        if (stop_)
+        {
+            return false;
+        }
+
+        reader = lookup_reader_nts_(topic_name, type_name);
+        if (nullptr == reader)
+        {
+            creating_topics_.insert(topic_name);
+        }
+    }
 
     if (nullptr == reader)
     {
-        if (!topic_query_callback_)
+        const bool created = create_topic_(topic_name, type_name, reader);
+        {
+            std::lock_guard<std::mutex> lck(mtx_);
+            creating_topics_.erase(topic_name);
+        }
+        cv_.notify_all();
+
+        if (!created)
         {
-            EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                    "Failed to publish data in topic " << topic_name <<
-                    " : topic is unknown and topic query callback not set.");
             return false;
         }
+    }
+
+    std::shared_ptr<const TypeCodec> codec;
+    if (!std::static_pointer_cast<CBHandler>(schema_handler_)->get_type_codec(type_name, codec))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to resolve topic " << topic_name << " : schema of type " << type_name << " not available.");
+        return false;
+    }
+
+    handle.topic_name = topic_name;
+    handle.type_name = type_name;
+    handle.reader = std::move(reader);
+    handle.codec = std::move(codec);
+    handle.data_representation = data_representation_(topic_name);
+    return true;
+}
+
+bool EnablerParticipant::publish(
+        const std::string& topic_name,
+        const std::string& json)
+{
+    TopicHandle handle;
+    return resolve_topic(topic_name, handle) && publish(handle, json);
+}
+
+bool EnablerParticipant::publish(
+        const TopicHandle& handle,
+        const std::string& json)
+{
+    if (!handle.valid())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish data: topic handle not resolved.");
+        return false;
+    }
+
+    // No lock required: the handle keeps the reader and codec alive, and injecting data in the reader is thread safe
+    auto data = serialize_sample_(handle, json);
+    if (nullptr == data)
+    {
+        return false;
+    }
+
+    handle.reader->simulate_data_reception(std::move(data));
+    return true;
+}
+
+bool EnablerParticipant::publish_serialized(
+        const std::string& topic_name,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation,
+        bool validate)
+{
+    TopicHandle handle;
+    return resolve_topic(topic_name, handle) &&
+           publish_serialized(handle, serialized_data, serialized_data_size, encapsulation, validate);
+}
+
+bool EnablerParticipant::publish_serialized(
+        const TopicHandle& handle,
+        const unsigned char* serialized_data,
+        uint32_t serialized_data_size,
+        uint16_t encapsulation,
+        bool validate)
+{
+    if (!handle.valid())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data: topic handle not resolved.");
+        return false;
+    }
+
+    if (nullptr == serialized_data ||
+            (validate && !validate_serialized_sample(handle, serialized_data, serialized_data_size, encapsulation)))
+    {
+        return false;
+    }
+
+    auto data = std::make_unique<RtpsPayloadData>();
+
+    if (!payload_pool_->get_payload(serialized_data_size, data->payload))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish serialized data in topic " << handle.topic_name << " : get_payload failed.");
+        return false;
+    }
+
+    // The pool owns the payload, so it is released once the sample is consumed, and shared (not copied) by writers
+    data->payload_owner = payload_pool_.get();
+    std::memcpy(data->payload.data, serialized_data, serialized_data_size);
+    data->payload.length = serialized_data_size;
+    data->payload.encapsulation = encapsulation;
+
+    handle.reader->simulate_data_reception(std::move(data));
+    return true;
+}
+
+bool EnablerParticipant::loan_payload(
+        const TopicHandle& handle,
+        uint32_t size,
+        PayloadLoan& loan)
+{
+    if (!handle.valid())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to loan payload: topic handle not resolved.");
+        return false;
+    }
+
+    if (0u == size)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to loan payload in topic " << handle.topic_name << " : empty payload requested.");
+        return false;
+    }
+
+    auto data = std::make_unique<RtpsPayloadData>();
+
+    if (!payload_pool_->get_payload(size, data->payload))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to loan payload in topic " << handle.topic_name << " : get_payload failed.");
+        return false;
+    }
+
+    // The pool owns the payload, so it is released if the loan is dropped, and shared (not copied) once committed
+    data->payload_owner = payload_pool_.get();
+    data->payload.length = size;
+
+    loan.handle_ = handle;
+    loan.data_ = std::move(data);
+    return true;
+}
+
+bool EnablerParticipant::commit_payload(
+        PayloadLoan& loan,
+        uint16_t encapsulation,
+        bool validate)
+{
+    if (!loan.valid())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to commit payload: no payload loaned.");
+        return false;
+    }
+
+    if (validate && !validate_serialized_sample(loan.handle_, loan.data(), loan.size(), encapsulation))
+    {
+        return false;
+    }
+
+    loan.data_->payload.encapsulation = encapsulation;
+
+    loan.handle_.reader->simulate_data_reception(std::move(loan.data_));
+    loan.handle_ = TopicHandle();
+    return true;
+}
 
-        std::string serialized_qos;
-        if (!topic_query_callback_(topic_name.c_str(), type_name, serialized_qos))
+void EnablerParticipant::publish_async(
+        const std::string& topic_name,
+        const std::string& json,
+        PublishCompletion callback)
+{
+    {
+        std::lock_guard<std::mutex> lck(mtx_);
+
+        auto pending = pending_publications_.find(topic_name);
+        if (pending == pending_publications_.end() && !stop_ && !topic_name.empty() &&
+                (0 != creating_topics_.count(topic_name) || nullptr == lookup_reader_nts_(topic_name)))
+        {
+            // Topic not ready yet: resolve it in the background, queueing its samples meanwhile
+            pending = pending_publications_.emplace(topic_name, std::deque<PendingPublication>()).first;
+            start_resolution_nts_(topic_name);
+        }
+
+        // Queue the sample behind those pending, so samples are published in order
+        if (pending != pending_publications_.end())
+        {
+            pending->second.push_back({json, std::move(callback)});
+            return;
+        }
+    }
+
+    // Topic ready: publish right away
+    const bool published = publish(topic_name, json);
+    if (callback)
+    {
+        callback(published);
+    }
+}
+
+void EnablerParticipant::declare_topic(
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lck(mtx_);
+
+    // Nothing to do if already known or being resolved
+    if (stop_ || topic_name.empty() || 0 != pending_publications_.count(topic_name) ||
+            0 != creating_topics_.count(topic_name) || nullptr != lookup_reader_nts_(topic_name))
+    {
+        return;
+    }
+
+    // Resolve it as an asynchronous publication without samples
+    pending_publications_.emplace(topic_name, std::deque<PendingPublication>());
+    start_resolution_nts_(topic_name);
+}
+
+bool EnablerParticipant::publish_batch(
+        const std::string& topic_name,
+        const std::vector<std::string>& jsons,
+        std::vector<bool>& results)
+{
+    TopicHandle handle;
+    if (!resolve_topic(topic_name, handle))
+    {
+        results.assign(jsons.size(), false);
+        return false;
+    }
+
+    return publish_batch(handle, jsons, results);
+}
+
+bool EnablerParticipant::publish_batch(
+        const TopicHandle& handle,
+        const std::vector<std::string>& jsons,
+        std::vector<bool>& results)
+{
+    results.assign(jsons.size(), false);
+
+    if (!handle.valid())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to publish data batch: topic handle not resolved.");
+        return false;
+    }
+
+    std::vector<std::unique_ptr<RtpsPayloadData>> samples(jsons.size());
+
+    auto serialize_range = [&](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    samples[i] = serialize_sample_(handle, jsons[i]);
+                }
+            };
+
+    // Split large batches in chunks of contiguous samples, all but the first one handed over to the thread pool
+    const size_t n_chunks = !thread_pool_ ? 1 : std::max<size_t>(1, std::min<size_t>(
+                        std::thread::hardware_concurrency(), jsons.size() / MIN_SAMPLES_PER_SERIALIZATION_CHUNK));
+    const size_t chunk_size = (jsons.size() + n_chunks - 1) / n_chunks;
+
+    std::mutex chunks_mtx;
+    std::condition_variable chunks_cv;
+    size_t pending_chunks = n_chunks - 1;
+
+    for (size_t i = 1; i < n_chunks; ++i)
+    {
+        const size_t begin = i * chunk_size;
+        const size_t end = std::min(jsons.size(), (i + 1) * chunk_size);
+        {
+            std::lock_guard<std::mutex> lck(serialization_queue_->mtx);
+            serialization_queue_->chunks.push_back([&, begin, end]()
+                    {
+                        serialize_range(begin, end);
+
+                        // Notify with the mutex taken, as the batch (and its condition variable) ends once released
+                        std::lock_guard<std::mutex> chunks_lck(chunks_mtx);
+                        pending_chunks--;
+                        chunks_cv.notify_all();
+                    });
+        }
+        thread_pool_->emit(serialization_task_id_);
+    }
+
+    // Serialize the first chunk, and then the pending ones (of any batch), so the batch progresses with a busy pool
+    serialize_range(0, std::min(jsons.size(), chunk_size));
+    while (serialization_queue_->run_next())
+    {
+    }
+
+    {
+        std::unique_lock<std::mutex> chunks_lck(chunks_mtx);
+        chunks_cv.wait(chunks_lck, [&]
+                {
+                    return 0 == pending_chunks;
+                });
+    }
+
+    // Inject the samples in order, once all of them are serialized
+    bool all_published = true;
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        if (nullptr == samples[i])
+        {
+            all_published = false;
+            continue;
+        }
+
+        handle.reader->simulate_data_reception(std::move(samples[i]));
+        results[i] = true;
+    }
+
+    return all_published;
+}
+
+bool EnablerParticipant::publish_batch_json(
+        const std::string& topic_name,
+        const std::string& batch,
+        std::vector<bool>& results)
+{
+    std::vector<std::string> jsons;
+
+    const size_t start = batch.find_first_not_of(" \t\r\n");
+    if (std::string::npos != start && '[' == batch[start])
+    {
+        // JSON array: every element is a sample
+        try
+        {
+            const nlohmann::json array = nlohmann::json::parse(batch);
+            jsons.reserve(array.size());
+            for (const auto& element : array)
+            {
+                jsons.push_back(element.dump());
+            }
+        }
+        catch (const std::exception& e)
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                    "Failed to publish data in topic " << topic_name << " : topic query callback failed.");
+                    "Failed to publish data batch in topic " << topic_name << " : invalid JSON array: " << e.what());
+            results.clear();
             return false;
         }
-
-        // Deserialize QoS if provided by the user (otherwise use default one)
-        TopicQoS qos;
-        if (!serialized_qos.empty())
+    }
+    else
+    {
+        // NDJSON: every non blank line is a sample
+        size_t line_begin = 0;
+        while (line_begin < batch.size())
         {
-            try
+            size_t line_end = batch.find('\n', line_begin);
+            if (std::string::npos == line_end)
             {
-                qos = serialization::deserialize_qos(serialized_qos);
+                line_end = batch.size();
             }
-            catch (const std::exception& e)
+
+            if (batch.find_first_not_of(" \t\r", line_begin) < line_end)
             {
-                EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                        "Failed to deserialize QoS for topic " << topic_name << ": " << e.what());
-                return false;
+                jsons.emplace_back(batch, line_begin, line_end - line_begin);
             }
+            line_begin = line_end + 1;
         }
+    }
 
-        fastdds::dds::xtypes::TypeIdentifier type_identifier;
-        if (!std::static_pointer_cast<CBHandler>(schema_handler_)->get_type_identifier(type_name, type_identifier))
+    return publish_batch(topic_name, jsons, results);
+}
+
+bool EnablerParticipant::SerializationQueue::run_next()
+{
+    std::function<void()> chunk;
+    {
+        std::lock_guard<std::mutex> lck(mtx);
+        if (chunks.empty())
+        {
+            return false;
+        }
+
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+    }
+
+    chunk();
+    return true;
+}
+
+void EnablerParticipant::start_resolution_nts_(
+        const std::string& topic_name)
+{
+    // Join the threads of finished resolutions
+    for (auto it = resolutions_.begin(); it != resolutions_.end();)
+    {
+        if (it->finished)
+        {
+            it->thread.join();
+            it = resolutions_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    auto resolution = resolutions_.emplace(resolutions_.end());
+    resolution->thread = std::thread(&EnablerParticipant::resolution_routine_, this, topic_name, &*resolution);
+}
+
+void EnablerParticipant::resolution_routine_(
+        std::string topic_name,
+        Resolution* resolution)
+{
+    TopicHandle handle;
+    const bool resolved = resolve_topic(topic_name, handle);
+
+    std::unique_lock<std::mutex> lck(mtx_);
+
+    // Publish the queued samples in order, including those queued while publishing (only this thread removes the entry)
+    auto pending = pending_publications_.find(topic_name);
+    while (!pending->second.empty())
+    {
+        std::deque<PendingPublication> publications;
+        publications.swap(pending->second);
+        const bool stopped = stop_;
+
+        lck.unlock();
+        for (PendingPublication& publication : publications)
+        {
+            const bool published = resolved && !stopped && publish(handle, publication.json);
+            if (publication.callback)
+            {
+                publication.callback(published);
+            }
+        }
+        lck.lock();
+    }
+    pending_publications_.erase(pending);
+
+    resolution->finished = true;
+}
+
+bool EnablerParticipant::create_topic_(
+        const std::string& topic_name,
+        std::string& type_name,
+        std::shared_ptr<InternalReader>& reader)
+{
+    if (!topic_query_callback_)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to resolve topic " << topic_name <<
+                " : topic is unknown and topic query callback not set.");
+        return false;
+    }
+
+    std::string serialized_qos;
+    if (!topic_query_callback_(topic_name.c_str(), type_name, serialized_qos))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to resolve topic " << topic_name << " : topic query callback failed.");
+        return false;
+    }
+
+    // Deserialize QoS if provided by the user (otherwise use default one)
+    TopicQoS qos;
+    if (!serialized_qos.empty())
+    {
+        try
+        {
+            qos = serialization::deserialize_qos(serialized_qos);
+        }
+        catch (const std::exception& e)
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                    "Failed to publish data in topic " << topic_name << " : type identifier not found.");
+                    "Failed to deserialize QoS for topic " << topic_name << ": " << e.what());
             return false;
         }
+    }
 
-        DdsTopic topic;
-        topic.m_topic_name = topic_name;
-        topic.type_name = type_name;
-        topic.topic_qos = qos;
-        topic.type_identifiers.type_identifier1(type_identifier);
-        this->discovery_database_->add_endpoint(rtps::CommonParticipant::simulate_endpoint(topic, this->id()));
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    if (!std::static_pointer_cast<CBHandler>(schema_handler_)->get_type_identifier(type_name, type_identifier))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
+                "Failed to resolve topic " << topic_name << " : type identifier not found.");
+        return false;
+    }
+
+    DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = type_name;
+    topic.topic_qos = qos;
+    topic.type_identifiers.type_identifier1(type_identifier);
+    this->discovery_database_->add_endpoint(rtps::CommonParticipant::simulate_endpoint(topic, this->id()));
 
-        // Wait for reader to be created from discovery thread
-        // NOTE: Set a timeout to avoid a deadlock in case the reader is never created for some reason (e.g. the topic
-        // is blocked or the underlying DDS Pipe object is disabled/destroyed before the reader is created).
+    // Wait for reader to be created from discovery thread (the mutex is released while waiting)
+    // NOTE: Set a timeout to avoid a deadlock in case the reader is never created for some reason (e.g. the topic
+    // is blocked or the underlying DDS Pipe object is disabled/destroyed before the reader is created).
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
         if (!cv_.wait_for(lck, std::chrono::seconds(5), [&]
                 {
-                    return nullptr != (reader = lookup_reader_nts_(topic_name));
-                }))
+                    return stop_ || nullptr != (reader = lookup_reader_nts_(topic_name));
+                }) || nullptr == reader)
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
                     "Failed to create internal reader for topic " << topic_name <<
                     " , please verify that the topic is allowed.");
             return false;
         }
+    }
 
-        // (Optionally) wait for writer created in DDS participant to match with external readers, to avoid losing this
-        // message when not using transient durability
-        std::this_thread::sleep_for(std::chrono::milliseconds(std::static_pointer_cast<EnablerParticipantConfiguration>(
-                    configuration_)->initial_publish_wait));
+    // (Optionally) wait for writer created in DDS participant to match with external readers, to avoid losing this
+    // message when not using transient durability. The wait ends early if the participant is destroyed meanwhile.
+    const auto& configuration = *std::static_pointer_cast<EnablerParticipantConfiguration>(configuration_);
+    const std::chrono::milliseconds initial_publish_wait(configuration.initial_publish_wait);
+    if (!match_tracker_)
+    {
+        std::unique_lock<std::mutex> lck(mtx_);
+        cv_.wait_for(lck, initial_publish_wait, [&]
+                {
+                    return stop_.load();
+                });
+    }
+    else if (!match_tracker_->wait_for_readers(topic_name, configuration.initial_publish_matched_readers,
+            initial_publish_wait, [this]
+            {
+                return stop_.load();
+            }) && !stop_)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_ENABLER_PARTICIPANT,
+                "Publishing in topic " << topic_name << " with " << match_tracker_->matched_readers(topic_name) <<
+                " matched readers, fewer than the " << configuration.initial_publish_matched_readers << " expected.");
     }
 
+    return !stop_;
+}
+
+std::unique_ptr<RtpsPayloadData> EnablerParticipant::serialize_sample_(
+        const TopicHandle& handle,
+        const std::string& json)
+{
     auto data = std::make_unique<RtpsPayloadData>();
 
-    Payload payload;
-    if (!std::static_pointer_cast<CBHandler>(schema_handler_)->get_serialized_data(type_name, json, payload))
+    // Serialize straight into a payload of the pool (shared with the handler), without any intermediate copy
+    if (!std::static_pointer_cast<CBHandler>(schema_handler_)->get_serialized_data(*handle.codec, json, data->payload,
+            handle.data_representation))
     {
         EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                "Failed to publish data in topic " << topic_name << " : data serialization failed.");
-        return false;
+                "Failed to publish data in topic " << handle.topic_name << " : data serialization failed.");
+        return nullptr;
     }
 
-    if (!payload_pool_->get_payload(payload, data->payload))
-    {
-        EPROSIMA_LOG_ERROR(DDSENABLER_ENABLER_PARTICIPANT,
-                "Failed to publish data in topic " << topic_name << " : get_payload failed.");
-        return false;
-    }
+    // The pool owns the payload, so it is released once the sample is consumed, and shared (not copied) by writers
+    data->payload_owner = payload_pool_.get();
 
-    reader->simulate_data_reception(std::move(data));
-    return true;
+    return data;
+}
+
+fastdds::dds::DataRepresentationId_t EnablerParticipant::data_representation_(
+        const std::string& topic_name) const
+{
+    const auto& configuration = *std::static_pointer_cast<EnablerParticipantConfiguration>(configuration_);
+
+    auto it = configuration.topic_data_representations.find(topic_name);
+    return it == configuration.topic_data_representations.end() ? configuration.data_representation : it->second;
 }
 
 std::shared_ptr<ddspipe::participants::InternalReader> EnablerParticipant::lookup_reader_nts_(
         const std::string& topic_name,
         std::string& type_name) const
 {
-    for (const auto& reader : readers_)
+    auto it = readers_by_name_.find(topic_name);
+    if (it == readers_by_name_.end())
     {
-        if (reader.first.m_topic_name == topic_name)
-        {
-            type_name = reader.first.type_name;
-            return reader.second;
-        }
+        return nullptr;
     }
-    return nullptr;
+
+    type_name = it->second->first.type_name;
+    return it->second->second;
 }
 
 std::shared_ptr<ddspipe::participants::InternalReader> EnablerParticipant::lookup_reader_nts_(
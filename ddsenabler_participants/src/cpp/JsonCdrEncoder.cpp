@@ -0,0 +1,1245 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file JsonCdrEncoder.cpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeMember.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
+#include <fastdds/dds/xtypes/type_representation/detail/dds_xtypes_typeobject.hpp>
+#include <fastdds/dds/xtypes/utils.hpp>
+
+#include <ddsenabler_participants/JsonCdrEncoder.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+namespace {
+
+namespace xtypes = eprosima::fastdds::dds::xtypes;
+
+using fastdds::dds::DynamicData;
+using fastdds::dds::DynamicDataFactory;
+using fastdds::dds::DynamicType;
+using fastdds::dds::DynamicTypeMember;
+using fastdds::dds::MemberDescriptor;
+using fastdds::dds::TypeDescriptor;
+using fastdds::dds::traits;
+
+//! Error raised while building the plan or encoding a sample, reported to the caller as a \c false return value
+class EncodingError : public std::runtime_error
+{
+public:
+
+    explicit EncodingError(
+            const std::string& message)
+        : std::runtime_error(message)
+    {
+    }
+
+};
+
+//! Encapsulation identifiers (endianness not included)
+constexpr uint16_t ENCAPSULATION_PLAIN_CDR = 0x0000;
+constexpr uint16_t ENCAPSULATION_PLAIN_CDR2 = 0x0006;
+constexpr uint16_t ENCAPSULATION_DELIMIT_CDR2 = 0x0008;
+constexpr uint16_t ENCAPSULATION_LITTLE_ENDIAN = 0x0001;
+
+//! Size of the encapsulation header preceding the serialized sample
+constexpr size_t ENCAPSULATION_SIZE = 4;
+
+//! Marks a structure member not found (yet) in the JSON object
+constexpr uint32_t MISSING_MEMBER = std::numeric_limits<uint32_t>::max();
+
+bool is_little_endian()
+{
+    const uint16_t probe {1};
+    return 1 == *reinterpret_cast<const uint8_t*>(&probe);
+}
+
+TypeDescriptor::_ref_type get_type_descriptor(
+        const DynamicType::_ref_type& dyn_type)
+{
+    TypeDescriptor::_ref_type descriptor {traits<TypeDescriptor>::make_shared()};
+    if (fastdds::dds::RETCODE_OK != dyn_type->get_descriptor(descriptor))
+    {
+        throw EncodingError("Failed to get descriptor of type " + dyn_type->get_name().to_string());
+    }
+    return descriptor;
+}
+
+MemberDescriptor::_ref_type get_member_descriptor(
+        const DynamicType::_ref_type& dyn_type,
+        uint32_t index)
+{
+    DynamicTypeMember::_ref_type member;
+    MemberDescriptor::_ref_type descriptor {traits<MemberDescriptor>::make_shared()};
+    if (fastdds::dds::RETCODE_OK != dyn_type->get_member_by_index(member, index) ||
+            fastdds::dds::RETCODE_OK != member->get_descriptor(descriptor))
+    {
+        throw EncodingError("Failed to get member " + std::to_string(index) + " of type " +
+                      dyn_type->get_name().to_string());
+    }
+    return descriptor;
+}
+
+DynamicType::_ref_type resolve_alias(
+        const DynamicType::_ref_type& dyn_type)
+{
+    DynamicType::_ref_type resolved = dyn_type;
+    while (xtypes::TK_ALIAS == resolved->get_kind())
+    {
+        resolved = get_type_descriptor(resolved)->base_type();
+    }
+    return resolved;
+}
+
+uint32_t get_bound(
+        const TypeDescriptor::_ref_type& descriptor)
+{
+    if (descriptor->bound().empty() || fastdds::dds::LENGTH_UNLIMITED == descriptor->bound().front())
+    {
+        return 0;
+    }
+    return descriptor->bound().front();
+}
+
+//! Kind of a JSON token
+enum class TokenKind : uint8_t
+{
+    NUL,
+    BOOLEAN,
+    INTEGER,
+    UNSIGNED,
+    FLOAT,
+    STRING,
+    KEY,
+    OBJECT,
+    ARRAY
+};
+
+//! JSON value (or object key), containers being followed by their contents
+struct Token
+{
+    TokenKind kind {TokenKind::NUL};
+
+    //! Index of the token following the value (and its contents)
+    uint32_t end {0};
+
+    //! Number of object members or array elements
+    uint32_t count {0};
+
+    bool boolean {false};
+    int64_t integer {0};
+    uint64_t unsigned_integer {0};
+    double floating {0};
+
+    //! Strings and keys text, stored in the context text buffer
+    size_t text_offset {0};
+    size_t text_size {0};
+};
+
+} /* namespace */
+
+//! Scratch state of an encoding, reused across samples
+struct JsonCdrEncoder::Context
+{
+    //! Tokens of the sample, in document order
+    std::vector<Token> tokens;
+
+    //! Text of every string and key of the sample
+    std::string text;
+
+    //! Containers being tokenized
+    std::vector<uint32_t> open;
+
+    //! Value tokens of the members of the structures being encoded (stacked by nesting level)
+    std::vector<uint32_t> values;
+
+    std::string_view text_of(
+            const Token& token) const
+    {
+        return std::string_view(text.data() + token.text_offset, token.text_size);
+    }
+
+    void clear()
+    {
+        tokens.clear();
+        text.clear();
+        open.clear();
+        values.clear();
+    }
+
+};
+
+namespace {
+
+//! SAX handler storing the JSON tokens of a sample in a context
+template<typename Context>
+class Tokenizer
+{
+public:
+
+    explicit Tokenizer(
+            Context& ctx)
+        : ctx_(ctx)
+    {
+    }
+
+    bool null()
+    {
+        push_value_(TokenKind::NUL);
+        return true;
+    }
+
+    bool boolean(
+            bool value)
+    {
+        push_value_(TokenKind::BOOLEAN).boolean = value;
+        return true;
+    }
+
+    bool number_integer(
+            int64_t value)
+    {
+        push_value_(TokenKind::INTEGER).integer = value;
+        return true;
+    }
+
+    bool number_unsigned(
+            uint64_t value)
+    {
+        push_value_(TokenKind::UNSIGNED).unsigned_integer = value;
+        return true;
+    }
+
+    bool number_float(
+            double value,
+            const std::string&)
+    {
+        push_value_(TokenKind::FLOAT).floating = value;
+        return true;
+    }
+
+    bool string(
+            std::string& value)
+    {
+        store_text_(push_value_(TokenKind::STRING), value);
+        return true;
+    }
+
+    bool binary(
+            nlohmann::json::binary_t&)
+    {
+        return false;
+    }
+
+    bool start_object(
+            std::size_t)
+    {
+        push_value_(TokenKind::OBJECT);
+        ctx_.open.push_back(static_cast<uint32_t>(ctx_.tokens.size() - 1));
+        return true;
+    }
+
+    bool key(
+            std::string& value)
+    {
+        ctx_.tokens[ctx_.open.back()].count++;
+        store_text_(push_(TokenKind::KEY), value);
+        return true;
+    }
+
+    bool end_object()
+    {
+        return close_();
+    }
+
+    bool start_array(
+            std::size_t)
+    {
+        push_value_(TokenKind::ARRAY);
+        ctx_.open.push_back(static_cast<uint32_t>(ctx_.tokens.size() - 1));
+        return true;
+    }
+
+    bool end_array()
+    {
+        return close_();
+    }
+
+    bool parse_error(
+            std::size_t,
+            const std::string&,
+            const nlohmann::json::exception&)
+    {
+        return false;
+    }
+
+protected:
+
+    Token& push_(
+            TokenKind kind)
+    {
+        ctx_.tokens.emplace_back();
+        Token& token = ctx_.tokens.back();
+        token.kind = kind;
+        token.end = static_cast<uint32_t>(ctx_.tokens.size());
+        return token;
+    }
+
+    Token& push_value_(
+            TokenKind kind)
+    {
+        // Object members are counted by key
+        if (!ctx_.open.empty() && TokenKind::ARRAY == ctx_.tokens[ctx_.open.back()].kind)
+        {
+            ctx_.tokens[ctx_.open.back()].count++;
+        }
+        return push_(kind);
+    }
+
+    void store_text_(
+            Token& token,
+            const std::string& value)
+    {
+        token.text_offset = ctx_.text.size();
+        token.text_size = value.size();
+        ctx_.text.append(value);
+    }
+
+    bool close_()
+    {
+        ctx_.tokens[ctx_.open.back()].end = static_cast<uint32_t>(ctx_.tokens.size());
+        ctx_.open.pop_back();
+        return true;
+    }
+
+    Context& ctx_;
+};
+
+} /* namespace */
+
+//! Computes the serialized size of a sample, following the same alignment rules as \c BufferWriter
+class JsonCdrEncoder::SizeWriter
+{
+public:
+
+    explicit SizeWriter(
+            bool xcdr2)
+        : xcdr2_(xcdr2)
+    {
+    }
+
+    bool xcdr2() const
+    {
+        return xcdr2_;
+    }
+
+    template<typename T>
+    void write(
+            const T&)
+    {
+        align_(sizeof(T));
+        offset_ += sizeof(T);
+    }
+
+    void write_bytes(
+            const char*,
+            size_t size)
+    {
+        offset_ += size;
+    }
+
+    size_t begin_dheader()
+    {
+        align_(sizeof(uint32_t));
+        const size_t position = offset_;
+        offset_ += sizeof(uint32_t);
+        return position;
+    }
+
+    void end_dheader(
+            size_t)
+    {
+    }
+
+    size_t size() const
+    {
+        return offset_;
+    }
+
+protected:
+
+    void align_(
+            size_t alignment)
+    {
+        // XCDR2 aligns 64 bits values to 4 bytes
+        alignment = std::min<size_t>(alignment, xcdr2_ ? 4 : 8);
+        offset_ = (offset_ + alignment - 1) & ~(alignment - 1);
+    }
+
+    const bool xcdr2_;
+    size_t offset_ {0};
+};
+
+//! Writes a sample in a buffer, in host endianness (alignment is relative to the end of the encapsulation header)
+class JsonCdrEncoder::BufferWriter
+{
+public:
+
+    BufferWriter(
+            unsigned char* buffer,
+            size_t size,
+            bool xcdr2)
+        : buffer_(buffer)
+        , size_(size)
+        , xcdr2_(xcdr2)
+    {
+    }
+
+    bool xcdr2() const
+    {
+        return xcdr2_;
+    }
+
+    template<typename T>
+    void write(
+            const T& value)
+    {
+        align_(sizeof(T));
+        write_bytes(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write_bytes(
+            const char* data,
+            size_t size)
+    {
+        reserve_(size);
+        std::memcpy(buffer_ + offset_, data, size);
+        offset_ += size;
+    }
+
+    size_t begin_dheader()
+    {
+        write(uint32_t{0});
+        return offset_ - sizeof(uint32_t);
+    }
+
+    void end_dheader(
+            size_t position)
+    {
+        const uint32_t dheader = static_cast<uint32_t>(offset_ - position - sizeof(uint32_t));
+        std::memcpy(buffer_ + position, &dheader, sizeof(dheader));
+    }
+
+    size_t size() const
+    {
+        return offset_;
+    }
+
+protected:
+
+    void align_(
+            size_t alignment)
+    {
+        alignment = std::min<size_t>(alignment, xcdr2_ ? 4 : 8);
+        const size_t padding = ((offset_ + alignment - 1) & ~(alignment - 1)) - offset_;
+        reserve_(padding);
+        std::memset(buffer_ + offset_, 0, padding);
+        offset_ += padding;
+    }
+
+    void reserve_(
+            size_t size)
+    {
+        if (offset_ + size > size_)
+        {
+            throw EncodingError("Serialized size exceeded");
+        }
+    }
+
+    unsigned char* buffer_;
+    const size_t size_;
+    const bool xcdr2_;
+    size_t offset_ {0};
+};
+
+std::unique_ptr<JsonCdrEncoder> JsonCdrEncoder::create(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    assert(nullptr != dyn_type);
+
+    const std::string type_name = dyn_type->get_name().to_string();
+
+    std::unique_ptr<JsonCdrEncoder> encoder(new JsonCdrEncoder());
+    try
+    {
+        std::map<DynamicType*, uint32_t> visited;
+        encoder->build_node_(dyn_type, visited);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
+                "Type " << type_name << " cannot be encoded directly from JSON: " << e.what());
+        return nullptr;
+    }
+
+    if (NodeKind::STRUCTURE != encoder->nodes_.front().kind || !encoder->validate_(dyn_type))
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
+                "Type " << type_name << " cannot be encoded directly from JSON.");
+        return nullptr;
+    }
+
+    return encoder;
+}
+
+bool JsonCdrEncoder::encode(
+        const std::string& json,
+        fastdds::dds::DataRepresentationId_t data_representation,
+        ddspipe::core::PayloadPool& payload_pool,
+        fastdds::rtps::SerializedPayload_t& payload) const
+{
+    static thread_local Context ctx;
+
+    const bool xcdr2 = fastdds::dds::DataRepresentationId::XCDR2_DATA_REPRESENTATION == data_representation;
+
+    // Check the whole sample (and compute its size) before reserving the payload
+    size_t size {0};
+    try
+    {
+        if (!tokenize_(json, ctx))
+        {
+            return false;
+        }
+        size = size_(xcdr2, ctx);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_CB_HANDLER,
+                "Failed to encode JSON sample: " << e.what());
+        return false;
+    }
+
+    if (!payload_pool.get_payload(static_cast<uint32_t>(size), payload))
+    {
+        return false;
+    }
+
+    try
+    {
+        write_(payload.data, size, xcdr2, ctx);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(DDSENABLER_CB_HANDLER,
+                "Failed to encode JSON sample after computing its size: " << e.what());
+        payload_pool.release_payload(payload);
+        return false;
+    }
+
+    payload.length = static_cast<uint32_t>(size);
+    payload.encapsulation = is_little_endian() ? CDR_LE : CDR_BE;
+
+    return true;
+}
+
+uint32_t JsonCdrEncoder::build_node_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        std::map<fastdds::dds::DynamicType*, uint32_t>& visited)
+{
+    const DynamicType::_ref_type type = resolve_alias(dyn_type);
+
+    auto it = visited.find(type.get());
+    if (it != visited.end())
+    {
+        return it->second;
+    }
+
+    // Reserve the node before visiting its members, so recursive types refer to it
+    const uint32_t index = static_cast<uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    visited[type.get()] = index;
+
+    const TypeDescriptor::_ref_type descriptor = get_type_descriptor(type);
+
+    Node node;
+    switch (type->get_kind())
+    {
+        case xtypes::TK_BOOLEAN:
+            node.kind = NodeKind::BOOLEAN;
+            break;
+        case xtypes::TK_BYTE:
+            node.kind = NodeKind::BYTE;
+            break;
+        case xtypes::TK_INT8:
+            node.kind = NodeKind::INT8;
+            break;
+        case xtypes::TK_UINT8:
+            node.kind = NodeKind::UINT8;
+            break;
+        case xtypes::TK_INT16:
+            node.kind = NodeKind::INT16;
+            break;
+        case xtypes::TK_UINT16:
+            node.kind = NodeKind::UINT16;
+            break;
+        case xtypes::TK_INT32:
+            node.kind = NodeKind::INT32;
+            break;
+        case xtypes::TK_UINT32:
+            node.kind = NodeKind::UINT32;
+            break;
+        case xtypes::TK_INT64:
+            node.kind = NodeKind::INT64;
+            break;
+        case xtypes::TK_UINT64:
+            node.kind = NodeKind::UINT64;
+            break;
+        case xtypes::TK_FLOAT32:
+            node.kind = NodeKind::FLOAT32;
+            break;
+        case xtypes::TK_FLOAT64:
+            node.kind = NodeKind::FLOAT64;
+            break;
+        case xtypes::TK_CHAR8:
+            node.kind = NodeKind::CHAR8;
+            break;
+        case xtypes::TK_STRING8:
+            node.kind = NodeKind::STRING8;
+            node.bound = get_bound(descriptor);
+            break;
+
+        case xtypes::TK_ENUM:
+        {
+            node.kind = NodeKind::ENUM;
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member = get_member_descriptor(type, i);
+                node.enumerators[member->name().to_string()] = std::stoll(member->default_value());
+
+                switch (resolve_alias(member->type())->get_kind())
+                {
+                    case xtypes::TK_INT8:
+                        node.literal_kind = NodeKind::INT8;
+                        break;
+                    case xtypes::TK_UINT8:
+                        node.literal_kind = NodeKind::UINT8;
+                        break;
+                    case xtypes::TK_INT16:
+                        node.literal_kind = NodeKind::INT16;
+                        break;
+                    case xtypes::TK_UINT16:
+                        node.literal_kind = NodeKind::UINT16;
+                        break;
+                    case xtypes::TK_UINT32:
+                        node.literal_kind = NodeKind::UINT32;
+                        break;
+                    default:
+                        node.literal_kind = NodeKind::INT32;
+                        break;
+                }
+            }
+            break;
+        }
+
+        case xtypes::TK_STRUCTURE:
+        {
+            node.kind = NodeKind::STRUCTURE;
+            switch (descriptor->extensibility_kind())
+            {
+                case fastdds::dds::ExtensibilityKind::FINAL:
+                    node.delimited = false;
+                    break;
+                case fastdds::dds::ExtensibilityKind::APPENDABLE:
+                    node.delimited = true;
+                    break;
+                default:
+                    throw EncodingError("Unsupported extensibility of type " + type->get_name().to_string());
+            }
+
+            for (uint32_t i = 0; i < type->get_member_count(); ++i)
+            {
+                const MemberDescriptor::_ref_type member_descriptor = get_member_descriptor(type, i);
+                if (member_descriptor->is_optional())
+                {
+                    throw EncodingError("Unsupported optional member " + member_descriptor->name().to_string());
+                }
+
+                Member member;
+                member.name = member_descriptor->name().to_string();
+                member.node = build_node_(member_descriptor->type(), visited);
+                node.members.push_back(std::move(member));
+            }
+
+            node.members_by_name.resize(node.members.size());
+            for (uint32_t i = 0; i < node.members_by_name.size(); ++i)
+            {
+                node.members_by_name[i] = i;
+            }
+            std::sort(node.members_by_name.begin(), node.members_by_name.end(), [&node](uint32_t lhs, uint32_t rhs)
+                    {
+                        return node.members[lhs].name < node.members[rhs].name;
+                    });
+            break;
+        }
+
+        case xtypes::TK_SEQUENCE:
+        {
+            node.kind = NodeKind::SEQUENCE;
+            node.bound = get_bound(descriptor);
+            node.element = build_node_(descriptor->element_type(), visited);
+            break;
+        }
+
+        case xtypes::TK_ARRAY:
+        {
+            node.kind = NodeKind::ARRAY;
+            node.dimensions = descriptor->bound();
+
+            // Arrays of arrays are serialized as a single flattened array
+            DynamicType::_ref_type element_type = resolve_alias(descriptor->element_type());
+            while (xtypes::TK_ARRAY == element_type->get_kind())
+            {
+                const TypeDescriptor::_ref_type element_descriptor = get_type_descriptor(element_type);
+                node.dimensions.insert(node.dimensions.end(), element_descriptor->bound().begin(),
+                        element_descriptor->bound().end());
+                element_type = resolve_alias(element_descriptor->element_type());
+            }
+
+            if (node.dimensions.empty() ||
+                    std::find(node.dimensions.begin(), node.dimensions.end(), 0u) != node.dimensions.end())
+            {
+                throw EncodingError("Invalid array dimensions in type " + type->get_name().to_string());
+            }
+
+            node.element = build_node_(element_type, visited);
+            break;
+        }
+
+        default:
+            throw EncodingError("Unsupported kind of type " + type->get_name().to_string());
+    }
+
+    if (NodeKind::SEQUENCE == node.kind || NodeKind::ARRAY == node.kind)
+    {
+        // Nodes still being built are structures, so they are never primitive
+        switch (nodes_[node.element].kind)
+        {
+            case NodeKind::STRING8:
+            case NodeKind::STRUCTURE:
+            case NodeKind::SEQUENCE:
+            case NodeKind::ARRAY:
+                node.primitive_element = false;
+                break;
+            default:
+                node.primitive_element = true;
+                break;
+        }
+    }
+
+    nodes_[index] = std::move(node);
+
+    return index;
+}
+
+bool JsonCdrEncoder::validate_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type) const
+{
+    DynamicData::_ref_type dyn_data = DynamicDataFactory::get_instance()->create_data(dyn_type);
+    if (nullptr == dyn_data)
+    {
+        return false;
+    }
+
+    bool valid = true;
+
+    std::stringstream ss_dyn_data;
+    ss_dyn_data << std::setw(4);
+    if (fastdds::dds::RETCODE_OK !=
+            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss_dyn_data))
+    {
+        valid = false;
+    }
+
+    if (valid)
+    {
+        try
+        {
+            Context ctx;
+            valid = tokenize_(ss_dyn_data.str(), ctx);
+
+            fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+            for (bool xcdr2 : {false, true})
+            {
+                if (!valid)
+                {
+                    break;
+                }
+
+                const auto data_representation = xcdr2 ?
+                        fastdds::dds::DataRepresentationId::XCDR2_DATA_REPRESENTATION :
+                        fastdds::dds::DataRepresentationId::XCDR_DATA_REPRESENTATION;
+
+                fastdds::rtps::SerializedPayload_t expected(
+                    pubsub_type.calculate_serialized_size(&dyn_data, data_representation));
+
+                const size_t size = size_(xcdr2, ctx);
+                std::vector<unsigned char> output(size);
+                write_(output.data(), size, xcdr2, ctx);
+
+                valid = pubsub_type.serialize(&dyn_data, expected, data_representation) &&
+                        expected.length == size &&
+                        std::equal(output.begin(), output.end(), expected.data);
+            }
+        }
+        catch (const std::exception&)
+        {
+            valid = false;
+        }
+    }
+
+    DynamicDataFactory::get_instance()->delete_data(dyn_data);
+
+    return valid;
+}
+
+bool JsonCdrEncoder::tokenize_(
+        const std::string& json,
+        Context& ctx) const
+{
+    ctx.clear();
+
+    Tokenizer<Context> tokenizer(ctx);
+    return nlohmann::json::sax_parse(json, &tokenizer) && !ctx.tokens.empty();
+}
+
+uint16_t JsonCdrEncoder::encapsulation_(
+        bool xcdr2) const
+{
+    uint16_t encapsulation = ENCAPSULATION_PLAIN_CDR;
+    if (xcdr2)
+    {
+        encapsulation = nodes_.front().delimited ? ENCAPSULATION_DELIMIT_CDR2 : ENCAPSULATION_PLAIN_CDR2;
+    }
+
+    return is_little_endian() ? encapsulation | ENCAPSULATION_LITTLE_ENDIAN : encapsulation;
+}
+
+size_t JsonCdrEncoder::size_(
+        bool xcdr2,
+        Context& ctx) const
+{
+    SizeWriter writer(xcdr2);
+    encode_value_(writer, 0, 0, ctx);
+    return ENCAPSULATION_SIZE + writer.size();
+}
+
+void JsonCdrEncoder::write_(
+        unsigned char* buffer,
+        size_t size,
+        bool xcdr2,
+        Context& ctx) const
+{
+    assert(size >= ENCAPSULATION_SIZE);
+
+    // Encapsulation identifier (big endian) and options
+    const uint16_t encapsulation = encapsulation_(xcdr2);
+    buffer[0] = static_cast<unsigned char>(encapsulation >> 8);
+    buffer[1] = static_cast<unsigned char>(encapsulation & 0xff);
+    buffer[2] = 0;
+    buffer[3] = 0;
+
+    BufferWriter writer(buffer + ENCAPSULATION_SIZE, size - ENCAPSULATION_SIZE, xcdr2);
+    encode_value_(writer, 0, 0, ctx);
+
+    if (writer.size() != size - ENCAPSULATION_SIZE)
+    {
+        throw EncodingError("Serialized size mismatch");
+    }
+}
+
+template<typename Writer>
+void JsonCdrEncoder::encode_value_(
+        Writer& writer,
+        uint32_t node_index,
+        uint32_t token_index,
+        Context& ctx) const
+{
+    const Node& node = nodes_[node_index];
+
+    switch (node.kind)
+    {
+        case NodeKind::STRUCTURE:
+        {
+            if (node.delimited && writer.xcdr2())
+            {
+                const size_t dheader = writer.begin_dheader();
+                encode_structure_(writer, node, token_index, ctx);
+                writer.end_dheader(dheader);
+            }
+            else
+            {
+                encode_structure_(writer, node, token_index, ctx);
+            }
+            break;
+        }
+
+        case NodeKind::SEQUENCE:
+        {
+            if (!node.primitive_element && writer.xcdr2())
+            {
+                const size_t dheader = writer.begin_dheader();
+                encode_sequence_(writer, node, token_index, ctx);
+                writer.end_dheader(dheader);
+            }
+            else
+            {
+                encode_sequence_(writer, node, token_index, ctx);
+            }
+            break;
+        }
+
+        case NodeKind::ARRAY:
+        {
+            if (!node.primitive_element && writer.xcdr2())
+            {
+                const size_t dheader = writer.begin_dheader();
+                encode_array_dimension_(writer, node, 0, token_index, ctx);
+                writer.end_dheader(dheader);
+            }
+            else
+            {
+                encode_array_dimension_(writer, node, 0, token_index, ctx);
+            }
+            break;
+        }
+
+        case NodeKind::ENUM:
+        {
+            const Token& token = ctx.tokens[token_index];
+            if (TokenKind::OBJECT != token.kind)
+            {
+                throw EncodingError("Enumeration is not an object");
+            }
+
+            // The value takes precedence over the name, the latter being only informative
+            int64_t value {0};
+            bool found = false;
+            for (uint32_t i = token_index + 1; i < token.end; i = ctx.tokens[i + 1].end)
+            {
+                const std::string_view key = ctx.text_of(ctx.tokens[i]);
+                const Token& value_token = ctx.tokens[i + 1];
+                if ("value" == key && TokenKind::INTEGER == value_token.kind)
+                {
+                    auto enumerator = std::find_if(node.enumerators.begin(), node.enumerators.end(),
+                                    [&](const std::pair<const std::string, int64_t>& candidate)
+                                    {
+                                        return candidate.second == value_token.integer;
+                                    });
+                    if (enumerator == node.enumerators.end())
+                    {
+                        throw EncodingError("Unknown enumerator value " + std::to_string(value_token.integer));
+                    }
+                    value = value_token.integer;
+                    found = true;
+                    break;
+                }
+                else if ("name" == key && TokenKind::STRING == value_token.kind)
+                {
+                    auto enumerator = node.enumerators.find(ctx.text_of(value_token));
+                    if (enumerator == node.enumerators.end())
+                    {
+                        throw EncodingError("Unknown enumerator " + std::string(ctx.text_of(value_token)));
+                    }
+                    value = enumerator->second;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                throw EncodingError("Enumeration without value");
+            }
+
+            switch (node.literal_kind)
+            {
+                case NodeKind::INT8:
+                    writer.write(static_cast<int8_t>(value));
+                    break;
+                case NodeKind::UINT8:
+                    writer.write(static_cast<uint8_t>(value));
+                    break;
+                case NodeKind::INT16:
+                    writer.write(static_cast<int16_t>(value));
+                    break;
+                case NodeKind::UINT16:
+                    writer.write(static_cast<uint16_t>(value));
+                    break;
+                case NodeKind::UINT32:
+                    writer.write(static_cast<uint32_t>(value));
+                    break;
+                default:
+                    writer.write(static_cast<int32_t>(value));
+                    break;
+            }
+            break;
+        }
+
+        case NodeKind::STRING8:
+        {
+            const Token& token = ctx.tokens[token_index];
+            if (TokenKind::STRING != token.kind)
+            {
+                throw EncodingError("String expected");
+            }
+
+            const std::string_view value = ctx.text_of(token);
+            if ((0 != node.bound && value.size() > node.bound) || std::string_view::npos != value.find('\0'))
+            {
+                throw EncodingError("Invalid string");
+            }
+
+            // Length includes the null terminator
+            writer.write(static_cast<uint32_t>(value.size() + 1));
+            writer.write_bytes(value.data(), value.size());
+            writer.write(char{0});
+            break;
+        }
+
+        default:
+            encode_primitive_(writer, node.kind, token_index, ctx);
+            break;
+    }
+}
+
+template<typename Writer>
+void JsonCdrEncoder::encode_structure_(
+        Writer& writer,
+        const Node& node,
+        uint32_t token_index,
+        Context& ctx) const
+{
+    const Token& token = ctx.tokens[token_index];
+    if (TokenKind::OBJECT != token.kind)
+    {
+        throw EncodingError("Structure is not an object");
+    }
+
+    // Find the value of every member, as JSON keys do not follow the serialization order
+    const size_t base = ctx.values.size();
+    ctx.values.resize(base + node.members.size(), MISSING_MEMBER);
+
+    for (uint32_t i = token_index + 1; i < token.end; i = ctx.tokens[i + 1].end)
+    {
+        const std::string_view key = ctx.text_of(ctx.tokens[i]);
+        auto member = std::lower_bound(node.members_by_name.begin(), node.members_by_name.end(), key,
+                        [&node](uint32_t lhs, const std::string_view& rhs)
+                        {
+                            return node.members[lhs].name < rhs;
+                        });
+        if (member == node.members_by_name.end() || node.members[*member].name != key)
+        {
+            throw EncodingError("Unknown member " + std::string(key));
+        }
+        if (MISSING_MEMBER != ctx.values[base + *member])
+        {
+            throw EncodingError("Duplicated member " + std::string(key));
+        }
+        ctx.values[base + *member] = i + 1;
+    }
+
+    for (size_t i = 0; i < node.members.size(); ++i)
+    {
+        // Nested structures may reallocate the values stack, so it is indexed on every access
+        const uint32_t value_index = ctx.values[base + i];
+        if (MISSING_MEMBER == value_index)
+        {
+            throw EncodingError("Missing member " + node.members[i].name);
+        }
+        encode_value_(writer, node.members[i].node, value_index, ctx);
+    }
+
+    ctx.values.resize(base);
+}
+
+template<typename Writer>
+void JsonCdrEncoder::encode_sequence_(
+        Writer& writer,
+        const Node& node,
+        uint32_t token_index,
+        Context& ctx) const
+{
+    const Token& token = ctx.tokens[token_index];
+    if (TokenKind::ARRAY != token.kind || (0 != node.bound && token.count > node.bound))
+    {
+        throw EncodingError("Invalid sequence");
+    }
+
+    writer.write(token.count);
+    for (uint32_t i = token_index + 1; i < token.end; i = ctx.tokens[i].end)
+    {
+        encode_value_(writer, node.element, i, ctx);
+    }
+}
+
+template<typename Writer>
+void JsonCdrEncoder::encode_array_dimension_(
+        Writer& writer,
+        const Node& node,
+        size_t dimension,
+        uint32_t token_index,
+        Context& ctx) const
+{
+    const Token& token = ctx.tokens[token_index];
+    if (TokenKind::ARRAY != token.kind || token.count != node.dimensions[dimension])
+    {
+        throw EncodingError("Invalid array");
+    }
+
+    const bool last_dimension = dimension + 1 == node.dimensions.size();
+    for (uint32_t i = token_index + 1; i < token.end; i = ctx.tokens[i].end)
+    {
+        if (last_dimension)
+        {
+            encode_value_(writer, node.element, i, ctx);
+        }
+        else
+        {
+            encode_array_dimension_(writer, node, dimension + 1, i, ctx);
+        }
+    }
+}
+
+template<typename Writer>
+void JsonCdrEncoder::encode_primitive_(
+        Writer& writer,
+        NodeKind kind,
+        uint32_t token_index,
+        Context& ctx) const
+{
+    const Token& token = ctx.tokens[token_index];
+
+    // Integers are written only if representable in the member type
+    auto write_integer = [&](auto type_tag)
+            {
+                using T = decltype(type_tag);
+                if (TokenKind::INTEGER == token.kind &&
+                        token.integer >= static_cast<int64_t>(std::numeric_limits<T>::min()) &&
+                        (token.integer < 0 ||
+                        static_cast<uint64_t>(token.integer) <= static_cast<uint64_t>(std::numeric_limits<T>::max())))
+                {
+                    writer.write(static_cast<T>(token.integer));
+                }
+                else if (TokenKind::UNSIGNED == token.kind &&
+                        token.unsigned_integer <= static_cast<uint64_t>(std::numeric_limits<T>::max()))
+                {
+                    writer.write(static_cast<T>(token.unsigned_integer));
+                }
+                else
+                {
+                    throw EncodingError("Integer out of range");
+                }
+            };
+
+    auto get_floating = [&]()
+            {
+                switch (token.kind)
+                {
+                    case TokenKind::FLOAT:
+                        return token.floating;
+                    case TokenKind::INTEGER:
+                        return static_cast<double>(token.integer);
+                    case TokenKind::UNSIGNED:
+                        return static_cast<double>(token.unsigned_integer);
+                    default:
+                        throw EncodingError("Number expected");
+                }
+            };
+
+    switch (kind)
+    {
+        case NodeKind::BOOLEAN:
+            if (TokenKind::BOOLEAN != token.kind)
+            {
+                throw EncodingError("Boolean expected");
+            }
+            writer.write(static_cast<uint8_t>(token.boolean ? 1 : 0));
+            break;
+        case NodeKind::BYTE:
+        case NodeKind::UINT8:
+            write_integer(uint8_t{});
+            break;
+        case NodeKind::INT8:
+            write_integer(int8_t{});
+            break;
+        case NodeKind::INT16:
+            write_integer(int16_t{});
+            break;
+        case NodeKind::UINT16:
+            write_integer(uint16_t{});
+            break;
+        case NodeKind::INT32:
+            write_integer(int32_t{});
+            break;
+        case NodeKind::UINT32:
+            write_integer(uint32_t{});
+            break;
+        case NodeKind::INT64:
+            write_integer(int64_t{});
+            break;
+        case NodeKind::UINT64:
+            write_integer(uint64_t{});
+            break;
+        case NodeKind::FLOAT32:
+            writer.write(static_cast<float>(get_floating()));
+            break;
+        case NodeKind::FLOAT64:
+            writer.write(get_floating());
+            break;
+        case NodeKind::CHAR8:
+            if (TokenKind::STRING != token.kind || 1 != token.text_size)
+            {
+                throw EncodingError("Character expected");
+            }
+            writer.write(ctx.text[token.text_offset]);
+            break;
+        default:
+            throw EncodingError("Unexpected node kind");
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,124 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SchemaNotifier.cpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <ddsenabler_participants/SchemaNotifier.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+SchemaNotifier::SchemaNotifier(
+        unsigned int n_threads,
+        NotificationFunction notify)
+    : notify_(std::move(notify))
+{
+    assert(notify_);
+
+    for (unsigned int i = 0; i < std::max(n_threads, 1u); ++i)
+    {
+        notification_threads_.emplace_back(&SchemaNotifier::notification_routine_, this);
+    }
+}
+
+SchemaNotifier::~SchemaNotifier()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        stop_ = true;
+    }
+    queue_cv_.notify_all();
+
+    for (std::thread& thread : notification_threads_)
+    {
+        thread.join();
+    }
+}
+
+void SchemaNotifier::push(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const fastdds::dds::xtypes::TypeIdentifier& type_id)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        PendingSchema schema{dyn_type, type_id, dyn_type->get_name().to_string()};
+        pending_types_[schema.type_name]++;
+        pending_count_++;
+        queue_.push_back(std::move(schema));
+    }
+    queue_cv_.notify_one();
+}
+
+void SchemaNotifier::wait(
+        const std::string& type_name) const
+{
+    // Fast path: nothing pending (the usual case once the types have been discovered)
+    if (0 == pending_count_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx_);
+    notified_cv_.wait(lock, [&]()
+            {
+                return 0 == pending_types_.count(type_name);
+            });
+}
+
+void SchemaNotifier::notification_routine_()
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    while (true)
+    {
+        queue_cv_.wait(lock, [&]()
+                {
+                    return stop_ || !queue_.empty();
+                });
+
+        // Queued schemas are notified before stopping, so no notification waiting for them is left blocked
+        if (queue_.empty())
+        {
+            return;
+        }
+
+        PendingSchema schema = std::move(queue_.front());
+        queue_.pop_front();
+
+        lock.unlock();
+        notify_(schema.dyn_type, schema.type_id);
+        lock.lock();
+
+        auto it = pending_types_.find(schema.type_name);
+        if (0 == --it->second)
+        {
+            pending_types_.erase(it);
+        }
+        pending_count_.fetch_sub(1, std::memory_order_release);
+
+        notified_cv_.notify_all();
+    }
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,130 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SchemaRegistry.cpp
+ */
+
+#include <functional>
+
+#include <ddsenabler_participants/SchemaRegistry.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+SchemaRegistry::Index::Index(
+        size_t capacity)
+    : mask(capacity - 1)
+    , slots(new std::atomic<const Schema*>[capacity])
+{
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+std::atomic<const SchemaRegistry::Schema*>& SchemaRegistry::Index::probe(
+        size_t hash,
+        const std::string& type_name) const noexcept
+{
+    // Linear probing. The index always has free slots, so the sequence ends in an empty slot at the latest.
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        const Schema* schema = slots[i].load(std::memory_order_acquire);
+        if (nullptr == schema || (schema->hash == hash && schema->type_name == type_name))
+        {
+            return slots[i];
+        }
+    }
+}
+
+SchemaRegistry::SchemaRegistry()
+{
+    indexes_.push_back(std::make_unique<Index>(INITIAL_CAPACITY));
+    index_.store(indexes_.back().get(), std::memory_order_release);
+}
+
+SchemaRegistry::~SchemaRegistry() = default;
+
+const SchemaRegistry::Schema* SchemaRegistry::find(
+        const std::string& type_name) const noexcept
+{
+    const Index* index = index_.load(std::memory_order_acquire);
+    return index->probe(std::hash<std::string>{}(type_name), type_name).load(std::memory_order_acquire);
+}
+
+bool SchemaRegistry::insert(
+        const std::string& type_name,
+        const fastdds::dds::xtypes::TypeIdentifier& type_id,
+        const std::shared_ptr<const TypeCodec>& codec)
+{
+    std::lock_guard<std::mutex> lock(insertion_mtx_);
+
+    const size_t hash = std::hash<std::string>{}(type_name);
+
+    const Index* index = index_.load(std::memory_order_relaxed);
+    if (nullptr != index->probe(hash, type_name).load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    // Fill the schema before publishing it, so readers finding it see it complete
+    schemas_.push_back({type_name, type_id, codec, hash});
+    const Schema* schema = &schemas_.back();
+
+    // Keep the load factor under 1/2 so probing sequences stay short
+    const size_t size = size_.load(std::memory_order_relaxed) + 1;
+    if (2 * size > index->mask + 1)
+    {
+        // Build a larger copy and swap it in, as readers may be probing the current one
+        auto new_index = std::make_unique<Index>(2 * (index->mask + 1));
+        for (const Schema& registered : schemas_)
+        {
+            publish_(*new_index, &registered);
+        }
+
+        indexes_.push_back(std::move(new_index));
+        index_.store(indexes_.back().get(), std::memory_order_release);
+    }
+    else
+    {
+        publish_(*index, schema);
+    }
+
+    size_.store(size, std::memory_order_release);
+
+    return true;
+}
+
+size_t SchemaRegistry::size() const noexcept
+{
+    return size_.load(std::memory_order_acquire);
+}
+
+bool SchemaRegistry::empty() const noexcept
+{
+    return 0 == size();
+}
+
+void SchemaRegistry::publish_(
+        const Index& index,
+        const Schema* schema) noexcept
+{
+    index.probe(schema->hash, schema->type_name).store(schema, std::memory_order_release);
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,207 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeCodec.cpp
+ */
+
+#include <cassert>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+
+#include <ddsenabler_participants/json_writer.hpp>
+
+#include <ddsenabler_participants/TypeCodec.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+TypeCodec::TypeCodec(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        unsigned int dynamic_data_pool_size)
+    : dyn_type_(dyn_type)
+    , pubsub_type_(dyn_type)
+    , dynamic_data_pool_size_(dynamic_data_pool_size)
+{
+    assert(nullptr != dyn_type);
+
+    type_name_ = dyn_type->get_name().to_string();
+    json_writer::write_string(type_name_json_, type_name_);
+
+    transcoder_ = CdrJsonTranscoder::create(dyn_type);
+    encoder_ = JsonCdrEncoder::create(dyn_type);
+
+    bounded_ = pubsub_type_.is_bounded();
+    max_serialized_size_ = pubsub_type_.max_serialized_type_size;
+
+    if (bounded_ && max_serialized_size_ <= MAX_PRESIZED_PAYLOAD_SIZE)
+    {
+        xcdr1_size_estimate_ = max_serialized_size_;
+        xcdr2_size_estimate_ = max_serialized_size_;
+    }
+
+    dynamic_data_pool_.reserve(dynamic_data_pool_size_);
+}
+
+fastdds::dds::DynamicData::_ref_type TypeCodec::deserialize(
+        const fastdds::rtps::SerializedPayload_t& payload) const
+{
+    // TODO fast this should not be done, but dyn types API is like it is.
+    auto& payload_no_const = const_cast<fastdds::rtps::SerializedPayload_t&>(payload);
+
+    dynamic_data_acquired_.fetch_add(1, std::memory_order_relaxed);
+
+    // Reuse a DynamicData object if available, as creating one allocates its whole tree
+    fastdds::dds::DynamicData::_ref_type dyn_data;
+    {
+        std::lock_guard<std::mutex> lock(dynamic_data_pool_mtx_);
+
+        if (!dynamic_data_pool_.empty())
+        {
+            dyn_data = std::move(dynamic_data_pool_.back());
+            dynamic_data_pool_.pop_back();
+        }
+    }
+
+    // Create a DynamicData object using the DynamicType otherwise
+    if (nullptr == dyn_data)
+    {
+        dynamic_data_allocated_.fetch_add(1, std::memory_order_relaxed);
+        dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type_);
+    }
+
+    // Deserialize data into the DynamicData object
+    if (!pubsub_type_.deserialize(payload_no_const, &dyn_data))
+    {
+        release(std::move(dyn_data));
+        return nullptr;
+    }
+
+    return dyn_data;
+}
+
+void TypeCodec::release(
+        fastdds::dds::DynamicData::_ref_type&& dyn_data) const
+{
+    // Objects still referenced elsewhere cannot be reused, as they would be modified under their owner's feet
+    if (nullptr == dyn_data || dyn_data.use_count() > 1)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(dynamic_data_pool_mtx_);
+
+        if (dynamic_data_pool_.size() >= dynamic_data_pool_size_)
+        {
+            return;
+        }
+    }
+
+    // Reset the object (outside the lock) so no value of the previous sample leaks into the next one
+    if (fastdds::dds::RETCODE_OK != dyn_data->clear_all_values())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(dynamic_data_pool_mtx_);
+
+    if (dynamic_data_pool_.size() < dynamic_data_pool_size_)
+    {
+        dynamic_data_pool_.push_back(std::move(dyn_data));
+    }
+}
+
+DynamicDataPoolStatistics TypeCodec::dynamic_data_statistics() const
+{
+    DynamicDataPoolStatistics statistics;
+    statistics.acquired = dynamic_data_acquired_.load(std::memory_order_relaxed);
+    statistics.allocated = dynamic_data_allocated_.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(dynamic_data_pool_mtx_);
+    statistics.pooled = dynamic_data_pool_.size();
+
+    return statistics;
+}
+
+uint32_t TypeCodec::calculate_serialized_size(
+        const fastdds::dds::DynamicData::_ref_type& dyn_data,
+        fastdds::dds::DataRepresentationId_t data_representation) const
+{
+    return pubsub_type_.calculate_serialized_size(&dyn_data, data_representation);
+}
+
+bool TypeCodec::serialize(
+        const fastdds::dds::DynamicData::_ref_type& dyn_data,
+        fastdds::rtps::SerializedPayload_t& payload,
+        fastdds::dds::DataRepresentationId_t data_representation) const
+{
+    return pubsub_type_.serialize(&dyn_data, payload, data_representation);
+}
+
+bool TypeCodec::serialize(
+        const fastdds::dds::DynamicData::_ref_type& dyn_data,
+        fastdds::dds::DataRepresentationId_t data_representation,
+        ddspipe::core::PayloadPool& payload_pool,
+        fastdds::rtps::SerializedPayload_t& payload) const
+{
+    std::atomic<uint32_t>& size_estimate =
+            fastdds::dds::DataRepresentationId::XCDR2_DATA_REPRESENTATION == data_representation ?
+            xcdr2_size_estimate_ : xcdr1_size_estimate_;
+
+    // Serialize straight into a payload of the estimated size, which fits most samples
+    uint32_t size = size_estimate.load(std::memory_order_relaxed);
+    if (0 != size)
+    {
+        if (!payload_pool.get_payload(size, payload))
+        {
+            return false;
+        }
+
+        if (pubsub_type_.serialize(&dyn_data, payload, data_representation))
+        {
+            return true;
+        }
+
+        payload_pool.release_payload(payload);
+    }
+
+    // Calculate the exact size otherwise, and grow the estimate (with some margin) so the next samples fit
+    size = pubsub_type_.calculate_serialized_size(&dyn_data, data_representation);
+
+    const uint32_t grown_size = size + size / 4;
+    uint32_t current_size = size_estimate.load(std::memory_order_relaxed);
+    while (current_size < grown_size &&
+            !size_estimate.compare_exchange_weak(current_size, grown_size, std::memory_order_relaxed))
+    {
+    }
+
+    if (!payload_pool.get_payload(size, payload))
+    {
+        return false;
+    }
+
+    if (!pubsub_type_.serialize(&dyn_data, payload, data_representation))
+    {
+        payload_pool.release_payload(payload);
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
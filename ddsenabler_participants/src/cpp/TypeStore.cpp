@@ -0,0 +1,346 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeStore.cpp
+ */
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsenabler_participants/TypeStore.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+namespace {
+
+//! Magic string and version at the beginning of every store file
+constexpr char STORE_MAGIC[8] = {'D', 'D', 'S', 'E', 'T', 'Y', 'P', 'E'};
+constexpr uint32_t STORE_VERSION = 1;
+constexpr size_t STORE_HEADER_SIZE = sizeof(STORE_MAGIC) + sizeof(STORE_VERSION);
+
+/**
+ * Read-only view of the whole contents of a file, memory-mapped where supported (read into memory otherwise).
+ */
+class MappedFile
+{
+public:
+
+    explicit MappedFile(
+            const std::string& file_path)
+    {
+#ifndef _WIN32
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        struct stat file_stat;
+        if (0 == ::fstat(fd, &file_stat) && file_stat.st_size > 0)
+        {
+            void* mapping = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != mapping)
+            {
+                data_ = static_cast<const unsigned char*>(mapping);
+                size_ = static_cast<size_t>(file_stat.st_size);
+            }
+        }
+
+        // The mapping remains valid after closing the file
+        ::close(fd);
+#else
+        std::ifstream ifs(file_path, std::ios::binary);
+        buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data_ = reinterpret_cast<const unsigned char*>(buffer_.data());
+        size_ = buffer_.size();
+#endif // _WIN32
+    }
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (nullptr != data_)
+        {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+#endif // _WIN32
+    }
+
+    MappedFile(
+            const MappedFile&) = delete;
+    MappedFile& operator =(
+            const MappedFile&) = delete;
+
+    const unsigned char* data() const noexcept
+    {
+        return data_;
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+private:
+
+    const unsigned char* data_ {nullptr};
+    size_t size_ {0};
+
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#endif // _WIN32
+};
+
+//! Read a 4 byte size at the given position, advancing it (\c false if out of bounds)
+bool read_size(
+        const unsigned char* data,
+        size_t end,
+        size_t& position,
+        uint32_t& value)
+{
+    if (end - position < sizeof(value))
+    {
+        return false;
+    }
+
+    std::memcpy(&value, data + position, sizeof(value));
+    position += sizeof(value);
+    return true;
+}
+
+//! Append raw bytes to a record under construction
+void append(
+        std::vector<char>& record,
+        const void* data,
+        size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    record.insert(record.end(), bytes, bytes + size);
+}
+
+} /* namespace */
+
+TypeStore::TypeStore(
+        const std::string& file_path)
+    : file_path_(file_path)
+{
+}
+
+bool TypeStore::load(
+        const Visitor& visitor)
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    std::error_code ec;
+    if (!std::filesystem::exists(file_path_, ec))
+    {
+        return true;
+    }
+
+    size_t valid_size = 0;
+    {
+        MappedFile file(file_path_);
+        const unsigned char* data = file.data();
+        const size_t size = file.size();
+
+        if (0 == size)
+        {
+            return true;
+        }
+
+        uint32_t version = 0;
+        if (size >= STORE_HEADER_SIZE)
+        {
+            std::memcpy(&version, data + sizeof(STORE_MAGIC), sizeof(version));
+        }
+
+        if (STORE_VERSION != version || 0 != std::memcmp(data, STORE_MAGIC, sizeof(STORE_MAGIC)))
+        {
+            EPROSIMA_LOG_ERROR(DDSENABLER_TYPE_STORE,
+                    "Failed to load type store " << file_path_ << " : not a type store file.");
+            return false;
+        }
+
+        size_t position = STORE_HEADER_SIZE;
+        valid_size = position;
+
+        while (position < size)
+        {
+            uint32_t record_size = 0;
+            if (!read_size(data, size, position, record_size) || size - position < record_size)
+            {
+                break;
+            }
+
+            const size_t record_end = position + record_size;
+
+            Key key;
+            uint32_t name_size = 0;
+            uint32_t serialized_type_size = 0;
+            if (record_end - position < key.size())
+            {
+                break;
+            }
+            std::memcpy(key.data(), data + position, key.size());
+            position += key.size();
+
+            if (!read_size(data, record_end, position, name_size) || record_end - position < name_size)
+            {
+                break;
+            }
+            std::string type_name(reinterpret_cast<const char*>(data + position), name_size);
+            position += name_size;
+
+            if (!read_size(data, record_end, position, serialized_type_size) ||
+                    record_end - position != serialized_type_size)
+            {
+                break;
+            }
+
+            if (keys_.insert(key).second)
+            {
+                visitor(type_name, data + position, serialized_type_size);
+            }
+
+            position = record_end;
+            valid_size = position;
+        }
+
+        if (valid_size == size)
+        {
+            return true;
+        }
+    }
+
+    // Drop the incomplete trailing record, so the types stored next are not appended after it
+    EPROSIMA_LOG_WARNING(DDSENABLER_TYPE_STORE,
+            "Discarding incomplete record at the end of type store " << file_path_ << ".");
+
+    std::filesystem::resize_file(file_path_, valid_size, ec);
+    if (ec)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_TYPE_STORE,
+                "Failed to repair type store " << file_path_ << " : " << ec.message());
+        return false;
+    }
+
+    return true;
+}
+
+bool TypeStore::store(
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        const std::string& type_name,
+        const unsigned char* serialized_type,
+        uint32_t serialized_type_size)
+{
+    Key key;
+    if (!get_key_(type_identifier, key))
+    {
+        EPROSIMA_LOG_INFO(DDSENABLER_TYPE_STORE,
+                "Not storing type " << type_name << " : type identifier not hashed.");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    if (keys_.count(key) > 0)
+    {
+        return true;
+    }
+
+    // Build the whole record first, so it is appended with a single write
+    const uint32_t name_size = static_cast<uint32_t>(type_name.size());
+    const uint32_t record_size = static_cast<uint32_t>(key.size() + sizeof(name_size) + name_size +
+            sizeof(serialized_type_size) + serialized_type_size);
+
+    std::vector<char> record;
+    record.reserve(STORE_HEADER_SIZE + sizeof(record_size) + record_size);
+
+    std::error_code ec;
+    if (!std::filesystem::exists(file_path_, ec) || 0 == std::filesystem::file_size(file_path_, ec))
+    {
+        append(record, STORE_MAGIC, sizeof(STORE_MAGIC));
+        append(record, &STORE_VERSION, sizeof(STORE_VERSION));
+    }
+
+    append(record, &record_size, sizeof(record_size));
+    append(record, key.data(), key.size());
+    append(record, &name_size, sizeof(name_size));
+    append(record, type_name.data(), name_size);
+    append(record, &serialized_type_size, sizeof(serialized_type_size));
+    append(record, serialized_type, serialized_type_size);
+
+    std::ofstream ofs(file_path_, std::ios::binary | std::ios::app);
+    if (!ofs.write(record.data(), static_cast<std::streamsize>(record.size())) || !ofs.flush())
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_TYPE_STORE,
+                "Failed to store type " << type_name << " in " << file_path_ << ".");
+        return false;
+    }
+
+    keys_.insert(key);
+    return true;
+}
+
+bool TypeStore::contains(
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier) const
+{
+    Key key;
+    if (!get_key_(type_identifier, key))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys_.count(key) > 0;
+}
+
+size_t TypeStore::size() const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+    return keys_.size();
+}
+
+bool TypeStore::get_key_(
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        Key& key)
+{
+    if (fastdds::dds::xtypes::EK_COMPLETE != type_identifier._d() &&
+            fastdds::dds::xtypes::EK_MINIMAL != type_identifier._d())
+    {
+        return false;
+    }
+
+    key = type_identifier.equivalence_hash();
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
@@ -0,0 +1,95 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterMatchTracker.cpp
+ */
+
+#include <algorithm>
+
+#include <ddsenabler_participants/WriterMatchTracker.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+
+void WriterMatchTracker::on_writer_matched(
+        const std::string& topic_name,
+        const fastdds::rtps::GUID_t& writer_guid,
+        bool matched)
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        unsigned int& readers = matched_readers_[topic_name][writer_guid];
+        if (matched)
+        {
+            readers++;
+        }
+        else if (readers > 0)
+        {
+            readers--;
+        }
+    }
+    cv_.notify_all();
+}
+
+bool WriterMatchTracker::wait_for_readers(
+        const std::string& topic_name,
+        unsigned int min_readers,
+        std::chrono::milliseconds timeout,
+        const std::function<bool()>& stop) const
+{
+    std::unique_lock<std::mutex> lock(mtx_);
+
+    bool matched = false;
+    cv_.wait_for(lock, timeout, [&]()
+            {
+                auto it = matched_readers_.find(topic_name);
+                matched = min_readers <= (it == matched_readers_.end() ? 0u : matched_readers_nts_(it->second));
+                return matched || (stop && stop());
+            });
+    return matched;
+}
+
+void WriterMatchTracker::interrupt_waits() const
+{
+    // Taking the mutex ensures every waiter either sees the stop condition or is already waiting to be notified
+    std::lock_guard<std::mutex> lock(mtx_);
+    cv_.notify_all();
+}
+
+unsigned int WriterMatchTracker::matched_readers(
+        const std::string& topic_name) const
+{
+    std::lock_guard<std::mutex> lock(mtx_);
+
+    auto it = matched_readers_.find(topic_name);
+    return it == matched_readers_.end() ? 0u : matched_readers_nts_(it->second);
+}
+
+unsigned int WriterMatchTracker::matched_readers_nts_(
+        const std::map<fastdds::rtps::GUID_t, unsigned int>& writers)
+{
+    unsigned int readers = 0;
+    for (const auto& writer : writers)
+    {
+        readers = std::max(readers, writer.second);
+    }
+    return readers;
+}
+
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
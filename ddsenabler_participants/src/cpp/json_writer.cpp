@@ -0,0 +1,301 @@
+// Copyright 2025 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file json_writer.cpp
+ */
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include <nlohmann/json.hpp>
+
+#include <ddsenabler_participants/json_writer.hpp>
+
+namespace eprosima {
+namespace ddsenabler {
+namespace participants {
+namespace json_writer {
+
+namespace {
+
+/**
+ * @brief Return the length of the UTF-8 sequence starting at \c data, or 0 if it is not well formed.
+ *
+ * Overlong encodings, surrogates and code points above U+10FFFF are rejected, as done by nlohmann's decoder.
+ */
+size_t utf8_sequence_length(
+        const unsigned char* data,
+        size_t available)
+{
+    const unsigned char lead = data[0];
+
+    size_t length;
+    unsigned char lower = 0x80;
+    unsigned char upper = 0xBF;
+
+    if (lead < 0x80)
+    {
+        return 1;
+    }
+    else if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        length = 2;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 3;
+        if (lead == 0xE0)
+        {
+            lower = 0xA0;
+        }
+        else if (lead == 0xED)
+        {
+            upper = 0x9F;
+        }
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 4;
+        if (lead == 0xF0)
+        {
+            lower = 0x90;
+        }
+        else if (lead == 0xF4)
+        {
+            upper = 0x8F;
+        }
+    }
+    else
+    {
+        return 0;
+    }
+
+    if (length > available)
+    {
+        return 0;
+    }
+
+    // Only the second byte has a restricted range
+    if (data[1] < lower || data[1] > upper)
+    {
+        return 0;
+    }
+
+    for (size_t i = 2; i < length; ++i)
+    {
+        if (data[i] < 0x80 || data[i] > 0xBF)
+        {
+            return 0;
+        }
+    }
+
+    return length;
+}
+
+} /* namespace */
+
+void write_indentation(
+        std::string& output,
+        uint32_t level)
+{
+    output.append(static_cast<size_t>(level) * INDENTATION_SPACES, ' ');
+}
+
+bool write_string(
+        std::string& output,
+        const char* data,
+        size_t size)
+{
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    const size_t initial_size = output.size();
+    output.reserve(initial_size + size + 2);
+    output.push_back('"');
+
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t i = 0;
+    while (i < size)
+    {
+        const unsigned char c = bytes[i];
+
+        if (c >= 0x80)
+        {
+            // Multi-byte sequences are copied verbatim once validated
+            size_t length = utf8_sequence_length(bytes + i, size - i);
+            if (0 == length)
+            {
+                output.resize(initial_size);
+                return false;
+            }
+            output.append(data + i, length);
+            i += length;
+            continue;
+        }
+
+        switch (c)
+        {
+            case '\b':
+                output.append("\\b");
+                break;
+            case '\t':
+                output.append("\\t");
+                break;
+            case '\n':
+                output.append("\\n");
+                break;
+            case '\f':
+                output.append("\\f");
+                break;
+            case '\r':
+                output.append("\\r");
+                break;
+            case '"':
+                output.append("\\\"");
+                break;
+            case '\\':
+                output.append("\\\\");
+                break;
+            default:
+                if (c <= 0x1F)
+                {
+                    output.append("\\u00");
+                    output.push_back(HEX_DIGITS[c >> 4]);
+                    output.push_back(HEX_DIGITS[c & 0x0F]);
+                }
+                else
+                {
+                    output.push_back(static_cast<char>(c));
+                }
+                break;
+        }
+        ++i;
+    }
+
+    output.push_back('"');
+    return true;
+}
+
+bool write_string(
+        std::string& output,
+        const std::string& value)
+{
+    return write_string(output, value.data(), value.size());
+}
+
+void write_integer(
+        std::string& output,
+        int64_t value)
+{
+    std::array<char, 24> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.append(buffer.data(), result.ptr);
+}
+
+void write_unsigned(
+        std::string& output,
+        uint64_t value)
+{
+    std::array<char, 24> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.append(buffer.data(), result.ptr);
+}
+
+void write_float(
+        std::string& output,
+        double value)
+{
+    if (!std::isfinite(value))
+    {
+        output.append("null");
+        return;
+    }
+
+    // Use the same grisu2 based algorithm as nlohmann serializer
+    std::array<char, 64> buffer;
+    char* end = nlohmann::detail::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.append(buffer.data(), end);
+}
+
+void write_boolean(
+        std::string& output,
+        bool value)
+{
+    output.append(value ? "true" : "false");
+}
+
+void write_nested(
+        std::string& output,
+        const std::string& json,
+        uint32_t level)
+{
+    if (0 == level)
+    {
+        output.append(json);
+        return;
+    }
+
+    size_t begin = 0;
+    size_t end;
+    while ((end = json.find('\n', begin)) != std::string::npos)
+    {
+        output.append(json, begin, end - begin + 1);
+        write_indentation(output, level);
+        begin = end + 1;
+    }
+    output.append(json, begin, std::string::npos);
+}
+
+bool write_utf8(
+        std::string& output,
+        uint32_t code_point)
+{
+    if (code_point < 0x80)
+    {
+        output.push_back(static_cast<char>(code_point));
+    }
+    else if (code_point < 0x800)
+    {
+        output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else if (code_point < 0x10000)
+    {
+        if (code_point >= 0xD800 && code_point <= 0xDFFF)
+        {
+            return false;
+        }
+        output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else if (code_point <= 0x10FFFF)
+    {
+        output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+} /* namespace json_writer */
+} /* namespace participants */
+} /* namespace ddsenabler */
+} /* namespace eprosima */
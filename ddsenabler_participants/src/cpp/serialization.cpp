@@ -16,13 +16,21 @@
  * @file serialization.cpp
  */
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <yaml-cpp/yaml.h>
 
 #include <cpp_utils/exception/InconsistencyException.hpp>
 #include <cpp_utils/utils.hpp>
 
+#include <fastcdr/exceptions/Exception.h>
+
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/common/CDRMessage_t.hpp>
@@ -171,10 +179,142 @@ std::string serialize_type_object(
 TypeObject deserialize_type_object(
         const std::string& typeobj_str);
 
-bool serialize_dynamic_type(
+namespace {
+
+//! Magic string, version and sizes of the type bundle format
+constexpr unsigned char TYPE_BUNDLE_MAGIC[4] = {'D', 'E', 'T', 'B'};
+constexpr uint8_t TYPE_BUNDLE_VERSION = 1;
+constexpr uint8_t TYPE_BUNDLE_BIG_ENDIAN_FLAG = 0x01;
+constexpr size_t TYPE_BUNDLE_HEADER_SIZE = 12;
+constexpr size_t TYPE_BUNDLE_INDEX_ENTRY_SIZE = 6 * sizeof(uint32_t);
+
+//! TypeIdentifier and TypeObject of a type, serialized with XCDR2
+struct EncodedType
+{
+    std::string type_identifier;
+    std::string type_object;
+};
+
+//! Encoded type along with the name it is stored with
+using NamedEncodedType = std::pair<std::string, EncodedType>;
+
+/**
+ * Types already encoded, keyed by the hash of their TypeIdentifier, so the types shared by many others (e.g. headers
+ * or timestamps) are encoded only once per process.
+ */
+class EncodedTypeCache
+{
+public:
+
+    static EncodedTypeCache& get_instance()
+    {
+        static EncodedTypeCache instance;
+        return instance;
+    }
+
+    bool find(
+            const TypeIdentifier& type_identifier,
+            EncodedType& encoded_type) const
+    {
+        if (!is_hashed_(type_identifier))
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mtx_);
+
+        auto it = types_.find(type_identifier.equivalence_hash());
+        if (it == types_.end())
+        {
+            return false;
+        }
+
+        encoded_type = it->second;
+        return true;
+    }
+
+    void insert(
+            const TypeIdentifier& type_identifier,
+            const EncodedType& encoded_type)
+    {
+        if (!is_hashed_(type_identifier))
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mtx_);
+        types_.emplace(type_identifier.equivalence_hash(), encoded_type);
+    }
+
+private:
+
+    static bool is_hashed_(
+            const TypeIdentifier& type_identifier)
+    {
+        return EK_COMPLETE == type_identifier._d() || EK_MINIMAL == type_identifier._d();
+    }
+
+    std::map<EquivalenceHash, EncodedType> types_;
+
+    mutable std::mutex mtx_;
+};
+
+//! Encode a type, unless already cached
+bool encode_type(
+        const TypeIdentifier& type_identifier,
+        const TypeObject& type_object,
+        EncodedType& encoded_type)
+{
+    if (EncodedTypeCache::get_instance().find(type_identifier, encoded_type))
+    {
+        return true;
+    }
+
+    try
+    {
+        encoded_type.type_identifier = serialize_type_identifier(type_identifier);
+        encoded_type.type_object = serialize_type_object(type_object);
+    }
+    catch (const utils::InconsistencyException& e)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                "Error serializing DynamicType. Error message:\n " << e.what());
+        return false;
+    }
+
+    EncodedTypeCache::get_instance().insert(type_identifier, encoded_type);
+    return true;
+}
+
+//! Encode a type registered in the type registry, unless already cached
+bool encode_registered_type(
+        const TypeIdentifier& type_identifier,
+        const std::string& type_name,
+        EncodedType& encoded_type)
+{
+    if (EncodedTypeCache::get_instance().find(type_identifier, encoded_type))
+    {
+        return true;
+    }
+
+    TypeObject type_object;
+    if (fastdds::dds::RETCODE_OK !=
+            fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
+                type_identifier,
+                type_object))
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION, "Error getting TypeObject for type " << type_name);
+        return false;
+    }
+
+    return encode_type(type_identifier, type_object, encoded_type);
+}
+
+//! Encode a type registered in the type registry and all its dependencies (first), named after the type
+bool encode_registered_type_with_dependencies(
         const std::string& type_name,
         const TypeIdentifier& type_identifier,
-        DynamicTypesCollection& dynamic_types)
+        std::vector<NamedEncodedType>& encoded_types)
 {
     TypeIdentifierPair type_identifiers;
 
@@ -193,72 +333,268 @@ bool serialize_dynamic_type(
         return false;
     }
 
-    std::string dependency_name;
+    const auto& type_dependencies = type_info.complete().dependent_typeids();
+    encoded_types.reserve(encoded_types.size() + type_dependencies.size() + 1);
+
     unsigned int dependency_index = 0;
-    const auto type_dependencies = type_info.complete().dependent_typeids();
-    for (auto dependency : type_dependencies)
+    for (const auto& dependency : type_dependencies)
     {
-        TypeIdentifier dependency_type_identifier;
-        dependency_type_identifier = dependency.type_id();
+        std::string dependency_name = type_name + "_" + std::to_string(dependency_index);
 
-        TypeObject dependency_type_object;
-        if (fastdds::dds::RETCODE_OK !=
-                fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
-                    dependency_type_identifier,
-                    dependency_type_object))
+        EncodedType encoded_dependency;
+        if (!encode_registered_type(dependency.type_id(), dependency_name, encoded_dependency))
         {
             EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
-                    "Error getting TypeObject of dependency " << "for type " << type_name);
+                    "Error serializing dependency " << dependency_name << " for type " << type_name);
             return false;
         }
-
-        dependency_name = type_name + "_" + std::to_string(dependency_index);
-
-        // Store dependency in dynamic_types collection
-        serialize_dynamic_type(dependency_type_identifier, dependency_type_object, dependency_name, dynamic_types);
+        encoded_types.emplace_back(std::move(dependency_name), std::move(encoded_dependency));
 
         // Increment suffix counter
         dependency_index++;
     }
 
-    TypeObject type_object;
-    if (fastdds::dds::RETCODE_OK !=
-            fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_object(
-                type_identifier,
-                type_object))
+    EncodedType encoded_type;
+    if (!encode_registered_type(type_identifier, type_name, encoded_type))
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION, "Error getting TypeObject for type " << type_name);
         return false;
     }
+    encoded_types.emplace_back(type_name, std::move(encoded_type));
 
-    // Store dynamic type in dynamic_types collection
-    return serialize_dynamic_type(type_identifier, type_object, type_name, dynamic_types);
+    return true;
 }
 
-bool serialize_dynamic_type(
-        const TypeIdentifier& type_identifier,
-        const TypeObject& type_object,
+//! Add an encoded type to a \c DynamicTypesCollection
+void add_encoded_type(
         const std::string& type_name,
+        const EncodedType& encoded_type,
         DynamicTypesCollection& dynamic_types)
 {
     DynamicType dynamic_type;
     dynamic_type.type_name(type_name);
+    dynamic_type.type_identifier(utils::base64_encode(encoded_type.type_identifier));
+    dynamic_type.type_object(utils::base64_encode(encoded_type.type_object));
+
+    dynamic_types.dynamic_types().push_back(std::move(dynamic_type));
+}
+
+//! Write a 4 byte little endian value at the given position of a bundle
+void write_uint32(
+        std::vector<unsigned char>& bundle,
+        size_t position,
+        uint32_t value)
+{
+    for (size_t i = 0; i < sizeof(value); ++i)
+    {
+        bundle[position + i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
 
+//! Read a 4 byte little endian value from a bundle
+uint32_t read_uint32(
+        const unsigned char* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+//! Deserialize XCDR2 type data straight from a buffer, without copying it
+template<class DynamicTypeData>
+bool decode_type_data(
+        const unsigned char* data,
+        uint32_t size,
+        fastcdr::Cdr::Endianness endianness,
+        DynamicTypeData& type_data)
+{
     try
     {
-        dynamic_type.type_identifier(utils::base64_encode(serialize_type_identifier(type_identifier)));
-        dynamic_type.type_object(utils::base64_encode(serialize_type_object(type_object)));
+        fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(const_cast<unsigned char*>(data)), size);
+        fastcdr::Cdr deser(fastbuffer, endianness, fastcdr::CdrVersion::XCDRv2);
+        fastcdr::deserialize(deser, type_data);
     }
-    catch (const utils::InconsistencyException& e)
+    catch (const fastcdr::exception::Exception& e)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                "Failed to deserialize type data: " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+//! Deserialize the types of a type bundle
+bool deserialize_type_bundle(
+        const unsigned char* bundle,
+        uint32_t bundle_size,
+        std::vector<DeserializedType>& types)
+{
+    if (bundle_size < TYPE_BUNDLE_HEADER_SIZE || TYPE_BUNDLE_VERSION != bundle[4])
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                "Unsupported type bundle.");
+        return false;
+    }
+
+    const fastcdr::Cdr::Endianness endianness = (bundle[5] & TYPE_BUNDLE_BIG_ENDIAN_FLAG) ?
+            fastcdr::Cdr::BIG_ENDIANNESS : fastcdr::Cdr::LITTLE_ENDIANNESS;
+    const uint32_t count = read_uint32(bundle + 8);
+
+    if ((bundle_size - TYPE_BUNDLE_HEADER_SIZE) / TYPE_BUNDLE_INDEX_ENTRY_SIZE < count)
+    {
+        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                "Truncated type bundle index.");
+        return false;
+    }
+
+    types.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        // Offset and size of the name, type identifier and type object of the entry
+        const unsigned char* index_entry = bundle + TYPE_BUNDLE_HEADER_SIZE + i * TYPE_BUNDLE_INDEX_ENTRY_SIZE;
+        uint32_t offsets[3];
+        uint32_t sizes[3];
+        for (size_t field = 0; field < 3; ++field)
+        {
+            offsets[field] = read_uint32(index_entry + 8 * field);
+            sizes[field] = read_uint32(index_entry + 8 * field + 4);
+
+            if (offsets[field] > bundle_size || sizes[field] > bundle_size - offsets[field])
+            {
+                EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                        "Type bundle entry " << i << " out of bounds.");
+                return false;
+            }
+        }
+
+        DeserializedType& type = types[i];
+        type.type_name.assign(reinterpret_cast<const char*>(bundle + offsets[0]), sizes[0]);
+        if (!decode_type_data(bundle + offsets[1], sizes[1], endianness, type.type_identifier) ||
+                !decode_type_data(bundle + offsets[2], sizes[2], endianness, type.type_object))
+        {
+            EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION,
+                    "Failed to deserialize " << type.type_name << " from type bundle.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+bool serialize_dynamic_type(
+        const std::string& type_name,
+        const TypeIdentifier& type_identifier,
+        DynamicTypesCollection& dynamic_types)
+{
+    std::vector<NamedEncodedType> encoded_types;
+    if (!encode_registered_type_with_dependencies(type_name, type_identifier, encoded_types))
+    {
+        return false;
+    }
+
+    // Store dependencies and dynamic type in dynamic_types collection
+    dynamic_types.dynamic_types().reserve(dynamic_types.dynamic_types().size() + encoded_types.size());
+    for (const auto& encoded_type : encoded_types)
+    {
+        add_encoded_type(encoded_type.first, encoded_type.second, dynamic_types);
+    }
+
+    return true;
+}
+
+bool serialize_dynamic_type(
+        const TypeIdentifier& type_identifier,
+        const TypeObject& type_object,
+        const std::string& type_name,
+        DynamicTypesCollection& dynamic_types)
+{
+    EncodedType encoded_type;
+    if (!encode_type(type_identifier, type_object, encoded_type))
+    {
+        return false;
+    }
+
+    add_encoded_type(type_name, encoded_type, dynamic_types);
+
+    return true;
+}
+
+bool serialize_type_bundle(
+        const std::string& type_name,
+        const TypeIdentifier& type_identifier,
+        std::vector<unsigned char>& bundle)
+{
+    std::vector<NamedEncodedType> encoded_types;
+    if (!encode_registered_type_with_dependencies(type_name, type_identifier, encoded_types))
     {
-        EPROSIMA_LOG_ERROR(DDSENABLER_SERIALIZATION, "Error serializing DynamicType. Error message:\n " << e.what());
         return false;
     }
 
-    dynamic_types.dynamic_types().push_back(dynamic_type);
+    // Header and index first, followed by the data of every entry
+    size_t size = TYPE_BUNDLE_HEADER_SIZE + encoded_types.size() * TYPE_BUNDLE_INDEX_ENTRY_SIZE;
+    for (const auto& encoded_type : encoded_types)
+    {
+        size += encoded_type.first.size() + encoded_type.second.type_identifier.size() +
+                encoded_type.second.type_object.size();
+    }
+
+    bundle.assign(size, 0);
+    std::copy(std::begin(TYPE_BUNDLE_MAGIC), std::end(TYPE_BUNDLE_MAGIC), bundle.begin());
+    bundle[4] = TYPE_BUNDLE_VERSION;
+    bundle[5] = (fastcdr::Cdr::DEFAULT_ENDIAN == fastcdr::Cdr::BIG_ENDIANNESS) ? TYPE_BUNDLE_BIG_ENDIAN_FLAG : 0;
+    write_uint32(bundle, 8, static_cast<uint32_t>(encoded_types.size()));
+
+    size_t index_position = TYPE_BUNDLE_HEADER_SIZE;
+    size_t data_position = TYPE_BUNDLE_HEADER_SIZE + encoded_types.size() * TYPE_BUNDLE_INDEX_ENTRY_SIZE;
+    for (const auto& encoded_type : encoded_types)
+    {
+        for (const std::string* field : {&encoded_type.first, &encoded_type.second.type_identifier,
+                                         &encoded_type.second.type_object})
+        {
+            write_uint32(bundle, index_position, static_cast<uint32_t>(data_position));
+            write_uint32(bundle, index_position + 4, static_cast<uint32_t>(field->size()));
+            index_position += 8;
+
+            std::copy(field->begin(), field->end(), bundle.begin() + data_position);
+            data_position += field->size();
+        }
+    }
 
     return true;
+}
+
+bool deserialize_types(
+        const unsigned char* serialized_types,
+        uint32_t serialized_types_size,
+        std::vector<DeserializedType>& types)
+{
+    types.clear();
+
+    if (serialized_types_size >= sizeof(TYPE_BUNDLE_MAGIC) &&
+            std::equal(std::begin(TYPE_BUNDLE_MAGIC), std::end(TYPE_BUNDLE_MAGIC), serialized_types))
+    {
+        return deserialize_type_bundle(serialized_types, serialized_types_size, types);
+    }
+
+    // Otherwise it is a dynamic types collection (format used before type bundles)
+    DynamicTypesCollection dynamic_types;
+    if (!deserialize_dynamic_types(serialized_types, serialized_types_size, dynamic_types))
+    {
+        return false;
+    }
+
+    types.resize(dynamic_types.dynamic_types().size());
+    for (size_t i = 0; i < types.size(); ++i)
+    {
+        if (!deserialize_dynamic_type(dynamic_types.dynamic_types()[i], types[i].type_name, types[i].type_identifier,
+                types[i].type_object))
+        {
+            return false;
+        }
+    }
 
+    return true;
 }
 
 bool deserialize_dynamic_type(
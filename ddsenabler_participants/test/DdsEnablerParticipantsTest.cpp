@@ -12,6 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -23,18 +36,36 @@
 #include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+#include <fastdds/dds/xtypes/utils.hpp>
+
+#include <nlohmann/json.hpp>
 
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
 #include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
 
 #include <CBHandler.hpp>
 #include <CBHandlerConfiguration.hpp>
 #include <CBMessage.hpp>
 #include <CBWriter.hpp>
+#include <CdrJsonTranscoder.hpp>
+#include <DeliveryQueue.hpp>
+#include <EnablerParticipant.hpp>
+#include <EnablerParticipantConfiguration.hpp>
+#include <PayloadLoan.hpp>
+#include <JsonCdrEncoder.hpp>
+#include <SchemaRegistry.hpp>
+#include <serialization.hpp>
+#include <TypeCodec.hpp>
+#include <TypeStore.hpp>
+#include <WriterMatchTracker.hpp>
 
 #include "types/DDSEnablerTestTypesPubSubTypes.hpp"
 
@@ -105,7 +136,64 @@ public:
             return;
         }
 
+        // Data of different topics may be notified concurrently
+        std::lock_guard<std::mutex> lock(current_test_instance_->data_mtx_);
+
         current_test_instance_->data_called_++;
+        current_test_instance_->last_data_json_ = json;
+        current_test_instance_->data_publish_times_[topic_name].push_back(publish_time);
+    }
+
+    // eprosima::ddsenabler::participants::DdsDataRawNotification data_raw_notification;
+    static void test_data_raw_notification_callback(
+            const char* topic_name,
+            const char* type_name,
+            const unsigned char* serialized_data,
+            uint32_t serialized_data_size,
+            uint16_t encapsulation,
+            const unsigned char* instance_handle,
+            const unsigned char* source_guid,
+            int64_t publish_time)
+    {
+        if (current_test_instance_ == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(current_test_instance_->data_mtx_);
+
+        current_test_instance_->data_raw_called_++;
+        current_test_instance_->last_raw_topic_name_ = topic_name;
+        current_test_instance_->last_raw_type_name_ = type_name;
+        current_test_instance_->last_raw_data_ = serialized_data;
+        current_test_instance_->last_raw_data_size_ = serialized_data_size;
+        current_test_instance_->last_raw_encapsulation_ = encapsulation;
+        std::copy(instance_handle, instance_handle + 16, current_test_instance_->last_raw_instance_handle_.begin());
+        std::copy(source_guid, source_guid + 16, current_test_instance_->last_raw_source_guid_.begin());
+        current_test_instance_->last_raw_publish_time_ = publish_time;
+    }
+
+    // eprosima::ddsenabler::participants::DdsDataBatchNotification data_batch_notification;
+    static void test_data_batch_notification_callback(
+            const participants::DdsDataRecord* records,
+            uint32_t records_count)
+    {
+        if (current_test_instance_ == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(current_test_instance_->data_mtx_);
+
+        current_test_instance_->data_batch_sizes_.push_back(records_count);
+        for (uint32_t i = 0; i < records_count; ++i)
+        {
+            // Records are only valid during the call, so keep a copy
+            current_test_instance_->data_batch_records_.push_back(
+                {records[i].topic_name, std::string(records[i].json, records[i].json_size)});
+            current_test_instance_->data_batch_publish_times_.push_back(records[i].publish_time);
+        }
+        current_test_instance_->data_batch_cv_.notify_all();
     }
 
     // eprosima::ddsenabler::participants::DdsTypeNotification type_notification;
@@ -142,7 +230,22 @@ public:
     uint32_t data_called_ = 0;
     uint32_t type_called_ = 0;
     uint32_t topic_called_ = 0;
-
+    std::string last_data_json_;
+    std::map<std::string, std::vector<int64_t>> data_publish_times_;
+    uint32_t data_raw_called_ = 0;
+    std::string last_raw_topic_name_;
+    std::string last_raw_type_name_;
+    const unsigned char* last_raw_data_ = nullptr;
+    uint32_t last_raw_data_size_ = 0;
+    uint16_t last_raw_encapsulation_ = 0;
+    std::array<unsigned char, 16> last_raw_instance_handle_{};
+    std::array<unsigned char, 16> last_raw_source_guid_{};
+    int64_t last_raw_publish_time_ = 0;
+    std::vector<uint32_t> data_batch_sizes_;
+    std::vector<std::pair<std::string, std::string>> data_batch_records_;
+    std::vector<int64_t> data_batch_publish_times_;
+    std::condition_variable data_batch_cv_;
+    std::mutex data_mtx_;
 
     // Pointer to the current test instance (for use in the static callback)
     static CBHandlerTest* current_test_instance_;
@@ -159,6 +262,11 @@ void get_dynamic_type(
     std::shared_ptr<TopicDataType> type_support;
     switch (num_type)
     {
+        case 4:
+        {
+            type_support.reset(new DDSEnablerTestType4PubSubType());
+            break;
+        }
         case 3:
         {
             type_support.reset(new DDSEnablerTestType3PubSubType());
@@ -212,6 +320,11 @@ void get_data_payload(
     std::shared_ptr<TopicDataType> type_support;
     switch (num_type)
     {
+        case 4:
+        {
+            type_support.reset(new DDSEnablerTestType4PubSubType());
+            break;
+        }
         case 3:
         {
             type_support.reset(new DDSEnablerTestType3PubSubType());
@@ -234,6 +347,114 @@ void get_data_payload(
     type_support->delete_data(data);
 }
 
+void get_filled_data_payload(
+        int num_type,
+        DataRepresentationId data_representation,
+        eprosima::ddspipe::core::types::Payload& payload)
+{
+    std::shared_ptr<TopicDataType> type_support;
+    void* data = nullptr;
+    switch (num_type)
+    {
+        case 4:
+        {
+            type_support.reset(new DDSEnablerTestType4PubSubType());
+            data = type_support->create_data();
+            static_cast<DDSEnablerTestType4*>(data)->value().value(-1234);
+            break;
+        }
+        case 3:
+        {
+            type_support.reset(new DDSEnablerTestType3PubSubType());
+            data = type_support->create_data();
+            for (int32_t i = 0; i < 10; ++i)
+            {
+                static_cast<DDSEnablerTestType3*>(data)->value()[i] = i * 1000 - 4000;
+            }
+            break;
+        }
+        case 2:
+        {
+            type_support.reset(new DDSEnablerTestType2PubSubType());
+            data = type_support->create_data();
+            static_cast<DDSEnablerTestType2*>(data)->value("Quote \" backslash \\ tab \t newline \n \x01 \xc3\xb1");
+            break;
+        }
+        case 1:
+        default:
+        {
+            type_support.reset(new DDSEnablerTestType1PubSubType());
+            data = type_support->create_data();
+            static_cast<DDSEnablerTestType1*>(data)->value(42);
+            break;
+        }
+    }
+    payload.reserve(type_support->calculate_serialized_size(data, data_representation));
+    ASSERT_TRUE(type_support->serialize(data, payload, data_representation));
+    type_support->delete_data(data);
+}
+
+void create_enabler_participant(
+        int num_type,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        std::shared_ptr<participants::EnablerParticipant>& participant,
+        participants::TopicHandle& handle,
+        std::shared_ptr<participants::EnablerParticipantConfiguration> configuration = nullptr)
+{
+    participants::CBHandlerConfiguration handler_config;
+    auto cb_handler = std::make_shared<CBHandlerTest>(handler_config, payload_pool);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(num_type, dynamic_type, type_id, pipe_topic);
+    cb_handler->add_schema(dynamic_type, type_id);
+
+    participant = std::make_shared<participants::EnablerParticipant>(
+        configuration ? configuration : std::make_shared<participants::EnablerParticipantConfiguration>(),
+        payload_pool,
+        std::make_shared<ddspipe::core::DiscoveryDatabase>(),
+        cb_handler);
+
+    // Create the reader the pipe creates once the topic is discovered, enabled so the published samples can be taken
+    auto reader = participant->create_reader(pipe_topic);
+    ASSERT_NE(reader, nullptr);
+    reader->set_on_data_available_callback([]()
+            {
+            });
+    reader->enable();
+
+    ASSERT_TRUE(participant->resolve_topic(pipe_topic.m_topic_name, handle));
+}
+
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> take_published_sample(
+        const participants::TopicHandle& handle)
+{
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    if (utils::ReturnCode::RETCODE_OK != handle.reader->take(data))
+    {
+        return nullptr;
+    }
+
+    return std::unique_ptr<ddspipe::core::types::RtpsPayloadData>(
+        static_cast<ddspipe::core::types::RtpsPayloadData*>(data.release()));
+}
+
+std::string get_json_through_dynamic_data(
+        const DynamicType::_ref_type& dynamic_type,
+        eprosima::ddspipe::core::types::Payload& payload)
+{
+    DynamicPubSubType pubsub_type(dynamic_type);
+    DynamicData::_ref_type dyn_data = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+    EXPECT_TRUE(pubsub_type.deserialize(payload, &dyn_data));
+
+    std::stringstream ss_dyn_data;
+    ss_dyn_data << std::setw(4);
+    EXPECT_EQ(RETCODE_OK, json_serialize(dyn_data, DynamicDataJsonFormat::EPROSIMA, ss_dyn_data));
+
+    return nlohmann::json::parse(ss_dyn_data.str()).dump(4);
+}
+
 TEST(DdsEnablerParticipantsTest, ddsenabler_participants_cb_handler_creation)
 {
     // Create Payload Pool
@@ -362,6 +583,49 @@ TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_with_schema)
     ASSERT_EQ(cb_handler_->data_called_, 1);
 }
 
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_schemas_in_background)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    // Create CB Handler configuration
+    participants::CBHandlerConfiguration handler_config;
+    handler_config.schema_notification_threads = 2;
+
+    // Create CB Handler
+    auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+    ASSERT_NE(cb_handler_, nullptr);
+
+    // Schemas are registered right away, and notified in the background
+    std::vector<ddspipe::core::types::DdsTopic> pipe_topics(4);
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        get_dynamic_type(num_type, dynamic_type, type_id, pipe_topics[num_type - 1]);
+        cb_handler_->add_schema(dynamic_type, type_id);
+    }
+    ASSERT_EQ(cb_handler_->schemas_.size(), 4);
+
+    // Samples are notified after the schema of their type
+    auto data = std::make_unique<eprosima::ddspipe::core::types::RtpsPayloadData>();
+    payload_pool_->get_payload(1000, data->payload);
+    data->payload_owner = payload_pool_.get();
+    get_data_payload(1, data->payload);
+
+    ASSERT_NO_THROW(cb_handler_->add_data(pipe_topics[0], *data));
+    ASSERT_EQ(cb_handler_->data_called_, 1);
+
+    // Topics are notified after the schema of their type
+    for (const auto& pipe_topic : pipe_topics)
+    {
+        cb_handler_->add_topic(pipe_topic);
+    }
+    ASSERT_EQ(cb_handler_->topic_called_, 4);
+    ASSERT_EQ(cb_handler_->type_called_, 4);
+}
+
 TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_without_schema)
 {
     // Create Payload Pool
@@ -392,6 +656,177 @@ TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_without_schema
     ASSERT_EQ(cb_handler_->data_called_, 0);
 }
 
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_raw)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    // Create CB Handler configuration
+    participants::CBHandlerConfiguration handler_config;
+
+    // Create CB Handler, only interested in raw data
+    auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+    ASSERT_NE(cb_handler_, nullptr);
+    cb_handler_->set_data_notification_callback(nullptr);
+    cb_handler_->set_data_raw_notification_callback(CBHandlerTest::test_data_raw_notification_callback);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+    cb_handler_->add_schema(dynamic_type, type_id);
+
+    auto data = std::make_unique<eprosima::ddspipe::core::types::RtpsPayloadData>();
+
+    payload_pool_->get_payload(1000, data->payload);
+    data->payload_owner = payload_pool_.get();
+    get_data_payload(1, data->payload);
+    data->instanceHandle.value[15] = 0x0f;
+    data->source_guid.guidPrefix.value[0] = 0x01;
+    data->source_guid.entityId.value[3] = 0x02;
+    data->source_timestamp = fastdds::rtps::Time_t(1, 0);
+
+    ASSERT_NO_THROW(cb_handler_->add_data(pipe_topic, *data));
+    ASSERT_EQ(cb_handler_->data_called_, 0);
+    ASSERT_EQ(cb_handler_->data_raw_called_, 1);
+
+    // The payload is handed over as is, without copying it
+    ASSERT_EQ(cb_handler_->last_raw_topic_name_, pipe_topic.topic_name());
+    ASSERT_EQ(cb_handler_->last_raw_type_name_, pipe_topic.type_name);
+    ASSERT_EQ(cb_handler_->last_raw_data_, data->payload.data);
+    ASSERT_EQ(cb_handler_->last_raw_data_size_, data->payload.length);
+    ASSERT_EQ(cb_handler_->last_raw_encapsulation_, data->payload.encapsulation);
+    ASSERT_EQ(cb_handler_->last_raw_instance_handle_[15], 0x0f);
+    ASSERT_EQ(cb_handler_->last_raw_source_guid_[0], 0x01);
+    ASSERT_EQ(cb_handler_->last_raw_source_guid_[15], 0x02);
+    ASSERT_EQ(cb_handler_->last_raw_publish_time_, 1000000000);
+
+    // Both notifications are sent if both callbacks are set
+    cb_handler_->set_data_notification_callback(CBHandlerTest::test_data_notification_callback);
+    ASSERT_NO_THROW(cb_handler_->add_data(pipe_topic, *data));
+    ASSERT_EQ(cb_handler_->data_called_, 1);
+    ASSERT_EQ(cb_handler_->data_raw_called_, 2);
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_batched)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    // Create CB Handler configuration, with small batches
+    participants::CBHandlerConfiguration handler_config;
+    handler_config.data_batch_max_samples = 3;
+    handler_config.data_batch_max_latency = 50;
+
+    // Create CB Handler, notifying both single and batched data
+    auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+    ASSERT_NE(cb_handler_, nullptr);
+    cb_handler_->set_data_batch_notification_callback(CBHandlerTest::test_data_batch_notification_callback);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+    cb_handler_->add_schema(dynamic_type, type_id);
+
+    auto data = std::make_unique<eprosima::ddspipe::core::types::RtpsPayloadData>();
+    payload_pool_->get_payload(1000, data->payload);
+    data->payload_owner = payload_pool_.get();
+    get_data_payload(1, data->payload);
+
+    // Full batches are delivered right away
+    constexpr uint32_t NUM_SAMPLES = 7;
+    for (uint32_t i = 0; i < NUM_SAMPLES; ++i)
+    {
+        data->source_timestamp = fastdds::rtps::Time_t(static_cast<int32_t>(i), 0);
+        ASSERT_NO_THROW(cb_handler_->add_data(pipe_topic, *data));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cb_handler_->data_mtx_);
+        ASSERT_EQ(cb_handler_->data_called_, NUM_SAMPLES);
+        ASSERT_EQ(cb_handler_->data_batch_sizes_, std::vector<uint32_t>({3, 3}));
+    }
+
+    // The remaining sample is delivered once the maximum latency elapses
+    {
+        std::unique_lock<std::mutex> lock(cb_handler_->data_mtx_);
+        ASSERT_TRUE(cb_handler_->data_batch_cv_.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return cb_handler_->data_batch_sizes_.size() == 3;
+                }));
+        ASSERT_EQ(cb_handler_->data_batch_sizes_.back(), 1);
+    }
+
+    // Batched records match the single notifications, in reception order
+    ASSERT_EQ(cb_handler_->data_batch_records_.size(), NUM_SAMPLES);
+    for (uint32_t i = 0; i < NUM_SAMPLES; ++i)
+    {
+        ASSERT_EQ(cb_handler_->data_batch_records_[i].first, pipe_topic.topic_name());
+        ASSERT_EQ(cb_handler_->data_batch_records_[i].second, cb_handler_->last_data_json_);
+        ASSERT_EQ(cb_handler_->data_batch_publish_times_[i], static_cast<int64_t>(i) * 1000000000);
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_resolve_unknown_type)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    {
+        // Create CB Handler configuration
+        participants::CBHandlerConfiguration handler_config;
+        handler_config.unknown_type_ttl = 60000;
+
+        // Create CB Handler
+        auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+        ASSERT_NE(cb_handler_, nullptr);
+
+        // The test callback does not provide the type, so it is not queried again until the TTL elapses
+        xtypes::TypeIdentifier type_id;
+        ASSERT_FALSE(cb_handler_->get_type_identifier("UnknownType", type_id));
+        ASSERT_EQ(cb_handler_->type_query_called, 1);
+        ASSERT_FALSE(cb_handler_->get_type_identifier("UnknownType", type_id));
+        ASSERT_EQ(cb_handler_->type_query_called, 1);
+
+        // Concurrent requests share a single resolution, or fail right away once the type is known to be unknown
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&cb_handler_]()
+                    {
+                        xtypes::TypeIdentifier thread_type_id;
+                        ASSERT_FALSE(cb_handler_->get_type_identifier("OtherUnknownType", thread_type_id));
+                    });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(cb_handler_->type_query_called, 2);
+    }
+
+    {
+        // Create CB Handler configuration
+        // Negative caching is disabled by default
+        participants::CBHandlerConfiguration handler_config;
+        ASSERT_EQ(handler_config.unknown_type_ttl, 0);
+
+        // Create CB Handler
+        auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+        ASSERT_NE(cb_handler_, nullptr);
+
+        // Without negative caching, the type is queried on every request
+        xtypes::TypeIdentifier type_id;
+        ASSERT_FALSE(cb_handler_->get_type_identifier("UnknownType", type_id));
+        ASSERT_FALSE(cb_handler_->get_type_identifier("UnknownType", type_id));
+        ASSERT_EQ(cb_handler_->type_query_called, 2);
+    }
+}
+
 TEST(DdsEnablerParticipantsTest, ddsenabler_participants_write_schema_first_time)
 {
     // Create Payload Pool
@@ -424,8 +859,10 @@ TEST(DdsEnablerParticipantsTest, ddsenabler_participants_write_schema_first_time
     msg.source_guid = data->source_guid;
     payload_pool_->get_payload(data->payload, msg.payload);
     msg.payload_owner = payload_pool_.get();
+    participants::TypeCodec codec(dynamic_type);
+    msg.codec = &codec;
 
-    cb_handler_->cb_writer_->write_data(msg, dynamic_type);
+    cb_handler_->cb_writer_->write_data(msg);
     // The data will be successfully written as the dynamic type exists and we are bypassing the handler schema check
     ASSERT_EQ(cb_handler_->data_called_, 1);
 
@@ -448,11 +885,1031 @@ TEST(DdsEnablerParticipantsTest, ddsenabler_participants_write_schema_first_time
     msg2.source_guid = data2->source_guid;
     payload_pool_->get_payload(data2->payload, msg2.payload);
     msg2.payload_owner = payload_pool_.get();
+    participants::TypeCodec codec2(dynamic_type2);
+    msg2.codec = &codec2;
 
-    cb_handler_->cb_writer_->write_data(msg2, dynamic_type2);
+    cb_handler_->cb_writer_->write_data(msg2);
     ASSERT_EQ(cb_handler_->data_called_, 2);
 }
 
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_transcode_cdr_to_json)
+{
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        get_dynamic_type(num_type, dynamic_type, type_id);
+
+        auto transcoder = participants::CdrJsonTranscoder::create(dynamic_type);
+        ASSERT_NE(transcoder, nullptr);
+
+        for (auto data_representation : {DataRepresentationId::XCDR_DATA_REPRESENTATION,
+                                         DataRepresentationId::XCDR2_DATA_REPRESENTATION})
+        {
+            eprosima::ddspipe::core::types::Payload payload;
+            get_filled_data_payload(num_type, data_representation, payload);
+
+            // The transcoded JSON must be identical to the one obtained through DynamicData
+            std::string json;
+            ASSERT_TRUE(transcoder->transcode(payload, json));
+            ASSERT_EQ(json, get_json_through_dynamic_data(dynamic_type, payload));
+
+            // Nested output is indented as if the JSON was dumped within an enclosing object
+            std::string nested_json;
+            ASSERT_TRUE(transcoder->transcode(payload, nested_json, 1));
+            nlohmann::json enclosing;
+            enclosing["data"] = nlohmann::json::parse(json);
+            ASSERT_EQ("{\n    \"data\": " + nested_json + "\n}", enclosing.dump(4));
+        }
+
+        // Malformed payloads are not transcoded, and the output is left untouched
+        eprosima::ddspipe::core::types::Payload payload;
+        get_filled_data_payload(num_type, DataRepresentationId::XCDR2_DATA_REPRESENTATION, payload);
+        payload.length = 5;
+        std::string json = "previous";
+        ASSERT_FALSE(transcoder->transcode(payload, json));
+        ASSERT_EQ(json, "previous");
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_encode_json_to_cdr)
+{
+    auto payload_pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        get_dynamic_type(num_type, dynamic_type, type_id);
+
+        auto encoder = participants::JsonCdrEncoder::create(dynamic_type);
+        ASSERT_NE(encoder, nullptr);
+
+        for (auto data_representation : {DataRepresentationId::XCDR_DATA_REPRESENTATION,
+                                         DataRepresentationId::XCDR2_DATA_REPRESENTATION})
+        {
+            eprosima::ddspipe::core::types::Payload expected_payload;
+            get_filled_data_payload(num_type, data_representation, expected_payload);
+            const std::string json = get_json_through_dynamic_data(dynamic_type, expected_payload);
+
+            // The encoded sample must be identical to the one serialized by the type support
+            eprosima::ddspipe::core::types::Payload payload;
+            ASSERT_TRUE(encoder->encode(json, data_representation, *payload_pool, payload));
+            ASSERT_EQ(payload.length, expected_payload.length);
+            ASSERT_TRUE(std::equal(payload.data, payload.data + payload.length, expected_payload.data));
+            ASSERT_EQ(get_json_through_dynamic_data(dynamic_type, payload), json);
+            payload_pool->release_payload(payload);
+        }
+
+        // Samples not matching the type are not encoded, so the caller can fall back to the DynamicData path
+        eprosima::ddspipe::core::types::Payload payload;
+        ASSERT_FALSE(encoder->encode("{}", DataRepresentationId::XCDR2_DATA_REPRESENTATION, *payload_pool, payload));
+        ASSERT_FALSE(encoder->encode("{\"unknown\": 1}", DataRepresentationId::XCDR2_DATA_REPRESENTATION,
+                *payload_pool, payload));
+        ASSERT_FALSE(encoder->encode("{\"value\": ", DataRepresentationId::XCDR2_DATA_REPRESENTATION,
+                *payload_pool, payload));
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_write_data_envelope)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    // Create CB Handler configuration
+    participants::CBHandlerConfiguration handler_config;
+
+    // Create CB Handler
+    auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+    ASSERT_NE(cb_handler_, nullptr);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(4, dynamic_type, type_id, pipe_topic);
+    participants::TypeCodec codec(dynamic_type);
+
+    // Topic names sorting before, between and after the top level keys, and colliding with one of them
+    const std::vector<std::string> topic_names = {"a_topic", "j_topic", "z_topic", "rt/\"quoted\"", "type"};
+    for (const auto& topic_name : topic_names)
+    {
+        pipe_topic.m_topic_name = topic_name;
+
+        participants::CBMessage msg;
+        msg.sequence_number = 1;
+        msg.topic = pipe_topic;
+        msg.codec = &codec;
+        msg.source_guid.guidPrefix.value[0] = 0x01;
+        msg.instanceHandle.value[15] = 0x0f;
+        payload_pool_->get_payload(1000, msg.payload);
+        msg.payload_owner = payload_pool_.get();
+        get_filled_data_payload(4, DataRepresentationId::XCDR2_DATA_REPRESENTATION, msg.payload);
+
+        const unsigned int data_called = cb_handler_->data_called_;
+        cb_handler_->cb_writer_->write_data(msg);
+        ASSERT_EQ(cb_handler_->data_called_, data_called + 1);
+
+        // The notification must be identical to the one built with nlohmann::json
+        nlohmann::json expected;
+        std::stringstream ss_source_guid_prefix;
+        ss_source_guid_prefix << msg.source_guid.guid_prefix();
+        expected["id"] = ss_source_guid_prefix.str();
+        expected["type"] = "fastdds";
+        expected[topic_name] = {
+            {"type", pipe_topic.type_name},
+            {"data", nlohmann::json::object()}
+        };
+        std::stringstream ss_instance_handle;
+        ss_instance_handle << msg.instanceHandle;
+        expected[topic_name]["data"][ss_instance_handle.str()] =
+                nlohmann::json::parse(get_json_through_dynamic_data(dynamic_type, msg.payload));
+
+        ASSERT_EQ(cb_handler_->last_data_json_, expected.dump(4));
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_add_data_concurrently)
+{
+    // Create Payload Pool
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+    ASSERT_NE(payload_pool_, nullptr);
+
+    // Create CB Handler configuration
+    participants::CBHandlerConfiguration handler_config;
+
+    // Create CB Handler
+    auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+    ASSERT_NE(cb_handler_, nullptr);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(4, dynamic_type, type_id, pipe_topic);
+    cb_handler_->add_schema(dynamic_type, type_id);
+
+    // One thread per topic, each one adding samples with increasing publish times
+    constexpr unsigned int NUM_TOPICS = 4;
+    constexpr unsigned int SAMPLES_PER_TOPIC = 100;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < NUM_TOPICS; ++i)
+    {
+        ddspipe::core::types::DdsTopic topic = pipe_topic;
+        topic.m_topic_name = "topic_" + std::to_string(i);
+
+        threads.emplace_back([&, topic]()
+                {
+                    for (unsigned int j = 0; j < SAMPLES_PER_TOPIC; ++j)
+                    {
+                        auto data = std::make_unique<eprosima::ddspipe::core::types::RtpsPayloadData>();
+
+                        payload_pool_->get_payload(1000, data->payload);
+                        data->payload_owner = payload_pool_.get();
+                        get_filled_data_payload(4, DataRepresentationId::XCDR2_DATA_REPRESENTATION, data->payload);
+                        data->source_timestamp = fastdds::rtps::Time_t(static_cast<int32_t>(j), 0);
+
+                        cb_handler_->add_data(topic, *data);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_TRUE(cb_handler_->unique_sequence_number_ == NUM_TOPICS * SAMPLES_PER_TOPIC);
+    ASSERT_EQ(cb_handler_->data_called_, NUM_TOPICS * SAMPLES_PER_TOPIC);
+
+    // The samples of each topic must be notified in the order they were added
+    ASSERT_EQ(cb_handler_->data_publish_times_.size(), NUM_TOPICS);
+    for (const auto& topic_publish_times : cb_handler_->data_publish_times_)
+    {
+        const std::vector<int64_t>& publish_times = topic_publish_times.second;
+        ASSERT_EQ(publish_times.size(), SAMPLES_PER_TOPIC);
+        ASSERT_TRUE(std::is_sorted(publish_times.begin(), publish_times.end()));
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_type_codec)
+{
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        ddspipe::core::types::DdsTopic pipe_topic;
+        get_dynamic_type(num_type, dynamic_type, type_id, pipe_topic);
+
+        participants::TypeCodec codec(dynamic_type);
+        ASSERT_EQ(codec.dyn_type(), dynamic_type);
+        ASSERT_EQ(codec.type_name(), pipe_topic.type_name);
+        ASSERT_EQ(codec.type_name_json(), nlohmann::json(pipe_topic.type_name).dump());
+        ASSERT_NE(codec.transcoder(), nullptr);
+
+        eprosima::ddspipe::core::types::Payload payload;
+        get_filled_data_payload(num_type, DataRepresentationId::XCDR2_DATA_REPRESENTATION, payload);
+
+        // Decoding and encoding again must give back the same sample
+        DynamicData::_ref_type dyn_data = codec.deserialize(payload);
+        ASSERT_NE(dyn_data, nullptr);
+
+        eprosima::ddspipe::core::types::Payload reencoded_payload;
+        reencoded_payload.reserve(codec.calculate_serialized_size(dyn_data,
+                DataRepresentationId::XCDR2_DATA_REPRESENTATION));
+        ASSERT_TRUE(codec.serialize(dyn_data, reencoded_payload, DataRepresentationId::XCDR2_DATA_REPRESENTATION));
+        ASSERT_EQ(get_json_through_dynamic_data(dynamic_type, reencoded_payload),
+                get_json_through_dynamic_data(dynamic_type, payload));
+
+        // Serializing into the pool must give back the same sample, both when sizing the payload and when estimating it
+        ddspipe::core::FastPayloadPool payload_pool;
+        for (int i = 0; i < 2; ++i)
+        {
+            eprosima::ddspipe::core::types::Payload pooled_payload;
+            ASSERT_TRUE(codec.serialize(dyn_data, DataRepresentationId::XCDR2_DATA_REPRESENTATION, payload_pool,
+                    pooled_payload));
+            ASSERT_EQ(pooled_payload.length, reencoded_payload.length);
+            ASSERT_EQ(get_json_through_dynamic_data(dynamic_type, pooled_payload),
+                    get_json_through_dynamic_data(dynamic_type, payload));
+            payload_pool.release_payload(pooled_payload);
+        }
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_dynamic_data_pool)
+{
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    get_dynamic_type(4, dynamic_type, type_id);
+
+    constexpr unsigned int POOL_SIZE = 2;
+    participants::TypeCodec codec(dynamic_type, POOL_SIZE);
+
+    eprosima::ddspipe::core::types::Payload filled_payload;
+    get_filled_data_payload(4, DataRepresentationId::XCDR2_DATA_REPRESENTATION, filled_payload);
+    eprosima::ddspipe::core::types::Payload default_payload;
+    default_payload.reserve(1000);
+    get_data_payload(4, default_payload);
+
+    // First sample allocates a new DynamicData
+    DynamicData::_ref_type dyn_data = codec.deserialize(filled_payload);
+    ASSERT_NE(dyn_data, nullptr);
+    ASSERT_EQ(codec.dynamic_data_statistics().acquired, 1u);
+    ASSERT_EQ(codec.dynamic_data_statistics().allocated, 1u);
+    codec.release(std::move(dyn_data));
+    ASSERT_EQ(codec.dynamic_data_statistics().pooled, 1u);
+
+    // Next ones reuse it, without leaking values from the previous sample
+    DynamicData::_ref_type reused_dyn_data = codec.deserialize(default_payload);
+    ASSERT_NE(reused_dyn_data, nullptr);
+    ASSERT_EQ(codec.dynamic_data_statistics().acquired, 2u);
+    ASSERT_EQ(codec.dynamic_data_statistics().allocated, 1u);
+    ASSERT_EQ(codec.dynamic_data_statistics().pooled, 0u);
+
+    DynamicData::_ref_type expected_dyn_data = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+    DynamicPubSubType pubsub_type(dynamic_type);
+    ASSERT_TRUE(pubsub_type.deserialize(default_payload, &expected_dyn_data));
+    ASSERT_TRUE(reused_dyn_data->equals(expected_dyn_data));
+
+    // Objects still referenced elsewhere are not reused
+    DynamicData::_ref_type shared_dyn_data = reused_dyn_data;
+    codec.release(std::move(reused_dyn_data));
+    ASSERT_EQ(codec.dynamic_data_statistics().pooled, 0u);
+
+    // The pool does not grow beyond its size
+    std::vector<DynamicData::_ref_type> dyn_datas;
+    for (unsigned int i = 0; i < POOL_SIZE + 1; ++i)
+    {
+        dyn_datas.push_back(codec.deserialize(filled_payload));
+    }
+    for (auto& data : dyn_datas)
+    {
+        codec.release(std::move(data));
+    }
+    ASSERT_EQ(codec.dynamic_data_statistics().pooled, POOL_SIZE);
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_schema_registry)
+{
+    participants::SchemaRegistry registry;
+    ASSERT_TRUE(registry.empty());
+    ASSERT_EQ(registry.find("type_0"), nullptr);
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+    auto codec = std::make_shared<const participants::TypeCodec>(dynamic_type);
+
+    // Register enough schemas for the index to grow several times, while looking them up from another thread
+    constexpr unsigned int NUM_SCHEMAS = 200;
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> lookup_failed{false};
+    std::thread reader([&]()
+            {
+                while (!stop)
+                {
+                    for (unsigned int i = 0; i < NUM_SCHEMAS; ++i)
+                    {
+                        const std::string type_name = "type_" + std::to_string(i);
+                        const participants::SchemaRegistry::Schema* schema = registry.find(type_name);
+                        if (nullptr != schema && (schema->type_name != type_name || schema->codec != codec))
+                        {
+                            lookup_failed = true;
+                        }
+                    }
+                }
+            });
+
+    for (unsigned int i = 0; i < NUM_SCHEMAS; ++i)
+    {
+        const std::string type_name = "type_" + std::to_string(i);
+        ASSERT_TRUE(registry.insert(type_name, type_id, codec));
+        ASSERT_FALSE(registry.insert(type_name, type_id, nullptr));
+        ASSERT_EQ(registry.size(), i + 1);
+    }
+
+    stop = true;
+    reader.join();
+    ASSERT_FALSE(lookup_failed);
+
+    for (unsigned int i = 0; i < NUM_SCHEMAS; ++i)
+    {
+        const participants::SchemaRegistry::Schema* schema = registry.find("type_" + std::to_string(i));
+        ASSERT_NE(schema, nullptr);
+        ASSERT_EQ(schema->type_id, type_id);
+        ASSERT_EQ(schema->codec, codec);
+    }
+    ASSERT_EQ(registry.find("type_" + std::to_string(NUM_SCHEMAS)), nullptr);
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_delivery_queue)
+{
+    const std::map<participants::DeliveryPolicy, std::vector<unsigned int>> expected_deliveries = {
+        {participants::DeliveryPolicy::DROP_OLDEST, {0, 2, 3}},
+        {participants::DeliveryPolicy::DROP_NEWEST, {0, 1, 2}},
+        {participants::DeliveryPolicy::KEEP_LAST_PER_INSTANCE, {0, 3, 2}}
+    };
+
+    for (const auto& expected : expected_deliveries)
+    {
+        // Deliveries wait until the gate is opened, emulating a slow consumer
+        std::mutex gate_mtx;
+        std::condition_variable gate_cv;
+        bool gate_open = false;
+        std::vector<unsigned int> delivered;
+
+        participants::DeliveryQueue queue(2, expected.first, 1, [&](const participants::CBMessage& msg)
+                {
+                    std::unique_lock<std::mutex> lock(gate_mtx);
+                    gate_cv.wait(lock, [&]()
+                    {
+                        return gate_open;
+                    });
+                    delivered.push_back(msg.sequence_number);
+                    gate_cv.notify_all();
+                });
+
+        auto push = [&](unsigned int sequence_number, uint8_t instance)
+                {
+                    auto msg = std::make_unique<participants::CBMessage>();
+                    msg->topic.m_topic_name = "topic";
+                    msg->sequence_number = sequence_number;
+                    msg->instanceHandle.value[0] = instance;
+                    queue.push(std::move(msg));
+                };
+
+        participants::DeliveryQueueStatistics statistics;
+        ASSERT_FALSE(queue.get_statistics("topic", statistics));
+
+        // Wait until the first sample is being delivered, so the rest remain queued
+        push(0, 0);
+        do
+        {
+            std::this_thread::yield();
+            ASSERT_TRUE(queue.get_statistics("topic", statistics));
+        }
+        while (statistics.depth > 0);
+
+        // The last sample does not fit in the queue
+        push(1, 1);
+        push(2, 2);
+        push(3, 1);
+
+        ASSERT_TRUE(queue.get_statistics("topic", statistics));
+        ASSERT_EQ(statistics.depth, 2);
+
+        // Replacing the pending sample of the same instance is accounted as coalescing, not as a drop
+        if (participants::DeliveryPolicy::KEEP_LAST_PER_INSTANCE == expected.first)
+        {
+            ASSERT_EQ(statistics.dropped, 0);
+            ASSERT_EQ(statistics.coalesced, 1);
+        }
+        else
+        {
+            ASSERT_EQ(statistics.dropped, 1);
+            ASSERT_EQ(statistics.coalesced, 0);
+        }
+
+        std::unique_lock<std::mutex> lock(gate_mtx);
+        gate_open = true;
+        gate_cv.notify_all();
+        ASSERT_TRUE(gate_cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return delivered.size() == expected.second.size();
+                }));
+        ASSERT_EQ(delivered, expected.second);
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_delivery_queue_coalescing)
+{
+    // Deliveries wait until the gate is opened, emulating a slow consumer
+    std::mutex gate_mtx;
+    std::condition_variable gate_cv;
+    bool gate_open = false;
+    std::map<std::string, std::vector<unsigned int>> delivered;
+
+    participants::DeliveryQueue queue(10, participants::DeliveryPolicy::BLOCK, 1,
+            [&](const participants::CBMessage& msg)
+            {
+                std::unique_lock<std::mutex> lock(gate_mtx);
+                gate_cv.wait(lock, [&]()
+                {
+                    return gate_open;
+                });
+                delivered[msg.topic.topic_name()].push_back(msg.sequence_number);
+                gate_cv.notify_all();
+            },
+            {"state*"});
+
+    auto push = [&](const std::string& topic_name, unsigned int sequence_number, uint8_t instance)
+            {
+                auto msg = std::make_unique<participants::CBMessage>();
+                msg->topic.m_topic_name = topic_name;
+                msg->sequence_number = sequence_number;
+                msg->instanceHandle.value[0] = instance;
+                queue.push(std::move(msg));
+            };
+
+    // Wait until the first sample is being delivered, so the rest remain queued
+    participants::DeliveryQueueStatistics statistics;
+    push("events", 0, 0);
+    do
+    {
+        std::this_thread::yield();
+        ASSERT_TRUE(queue.get_statistics("events", statistics));
+    }
+    while (statistics.depth > 0);
+
+    for (const std::string topic_name : {"state", "events"})
+    {
+        push(topic_name, 1, 1);
+        push(topic_name, 2, 2);
+        push(topic_name, 3, 1);
+        push(topic_name, 4, 1);
+    }
+
+    // Only the latest sample of each instance remains pending in coalesced topics
+    ASSERT_TRUE(queue.get_statistics("state", statistics));
+    ASSERT_EQ(statistics.depth, 2);
+    ASSERT_EQ(statistics.coalesced, 2);
+    ASSERT_EQ(statistics.dropped, 0);
+
+    ASSERT_TRUE(queue.get_statistics("events", statistics));
+    ASSERT_EQ(statistics.depth, 4);
+    ASSERT_EQ(statistics.coalesced, 0);
+
+    std::unique_lock<std::mutex> lock(gate_mtx);
+    gate_open = true;
+    gate_cv.notify_all();
+    ASSERT_TRUE(gate_cv.wait_for(lock, std::chrono::seconds(5), [&]()
+            {
+                return delivered["state"].size() == 2 && delivered["events"].size() == 5;
+            }));
+    ASSERT_EQ(delivered["state"], std::vector<unsigned int>({4, 2}));
+    ASSERT_EQ(delivered["events"], std::vector<unsigned int>({0, 1, 2, 3, 4}));
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_writer_match_tracker)
+{
+    participants::WriterMatchTracker tracker;
+
+    fastdds::rtps::GUID_t writer;
+    writer.entityId.value[3] = 1;
+    fastdds::rtps::GUID_t other_writer;
+    other_writer.entityId.value[3] = 2;
+
+    // Nothing matched yet: the wait times out
+    ASSERT_EQ(tracker.matched_readers("topic"), 0u);
+    ASSERT_FALSE(tracker.wait_for_readers("topic", 1, std::chrono::milliseconds(10)));
+
+    // Waiting for no readers returns right away
+    ASSERT_TRUE(tracker.wait_for_readers("topic", 0, std::chrono::milliseconds(0)));
+
+    // The wait returns as soon as enough readers match, well before the deadline
+    std::thread matcher([&]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                tracker.on_writer_matched("topic", writer, true);
+                tracker.on_writer_matched("other_topic", other_writer, true);
+                tracker.on_writer_matched("topic", writer, true);
+            });
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(tracker.wait_for_readers("topic", 2, std::chrono::seconds(10)));
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    matcher.join();
+
+    ASSERT_EQ(tracker.matched_readers("topic"), 2u);
+    ASSERT_EQ(tracker.matched_readers("other_topic"), 1u);
+
+    // Readers matched by another writer of the topic are not counted twice
+    tracker.on_writer_matched("topic", other_writer, true);
+    ASSERT_EQ(tracker.matched_readers("topic"), 2u);
+    ASSERT_FALSE(tracker.wait_for_readers("topic", 3, std::chrono::milliseconds(10)));
+
+    // Unmatched readers are discounted
+    tracker.on_writer_matched("topic", writer, false);
+    ASSERT_EQ(tracker.matched_readers("topic"), 1u);
+    ASSERT_FALSE(tracker.wait_for_readers("topic", 2, std::chrono::milliseconds(10)));
+
+    // The wait ends early once its stop condition holds and the waits are interrupted
+    std::atomic<bool> stop {false};
+    std::thread stopper([&]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                stop = true;
+                tracker.interrupt_waits();
+            });
+    const auto stop_start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(tracker.wait_for_readers("topic", 2, std::chrono::seconds(10), [&]()
+            {
+                return stop.load();
+            }));
+    ASSERT_LT(std::chrono::steady_clock::now() - stop_start, std::chrono::seconds(5));
+    stopper.join();
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_serialize_dynamic_type)
+{
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        ddspipe::core::types::DdsTopic pipe_topic;
+        get_dynamic_type(num_type, dynamic_type, type_id, pipe_topic);
+
+        // Serializing again (from the already encoded types) must give the same collection
+        participants::DynamicTypesCollection first_collection;
+        ASSERT_TRUE(participants::serialization::serialize_dynamic_type(pipe_topic.type_name, type_id,
+                first_collection));
+        participants::DynamicTypesCollection second_collection;
+        ASSERT_TRUE(participants::serialization::serialize_dynamic_type(pipe_topic.type_name, type_id,
+                second_collection));
+        ASSERT_EQ(first_collection, second_collection);
+
+        // The main type is the last one in the collection
+        ASSERT_FALSE(second_collection.dynamic_types().empty());
+        std::string type_name;
+        xtypes::TypeIdentifier deserialized_type_id;
+        xtypes::TypeObject type_object;
+        ASSERT_TRUE(participants::serialization::deserialize_dynamic_type(second_collection.dynamic_types().back(),
+                type_name, deserialized_type_id, type_object));
+        ASSERT_EQ(type_name, pipe_topic.type_name);
+        ASSERT_EQ(deserialized_type_id, type_id);
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_type_bundle)
+{
+    for (int num_type = 1; num_type <= 4; ++num_type)
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        ddspipe::core::types::DdsTopic pipe_topic;
+        get_dynamic_type(num_type, dynamic_type, type_id, pipe_topic);
+
+        std::vector<unsigned char> bundle;
+        ASSERT_TRUE(participants::serialization::serialize_type_bundle(pipe_topic.type_name, type_id, bundle));
+
+        std::vector<participants::serialization::DeserializedType> bundle_types;
+        ASSERT_TRUE(participants::serialization::deserialize_types(bundle.data(), static_cast<uint32_t>(bundle.size()),
+                bundle_types));
+        ASSERT_FALSE(bundle_types.empty());
+        ASSERT_EQ(bundle_types.back().type_name, pipe_topic.type_name);
+        ASSERT_EQ(bundle_types.back().type_identifier, type_id);
+
+        // Serialized collections are still accepted, and hold the same types
+        participants::DynamicTypesCollection collection;
+        ASSERT_TRUE(participants::serialization::serialize_dynamic_type(pipe_topic.type_name, type_id, collection));
+        auto collection_payload = participants::serialization::serialize_dynamic_types(collection);
+        ASSERT_NE(collection_payload, nullptr);
+
+        std::vector<participants::serialization::DeserializedType> collection_types;
+        ASSERT_TRUE(participants::serialization::deserialize_types(collection_payload->data,
+                collection_payload->length, collection_types));
+        ASSERT_EQ(collection_types.size(), bundle_types.size());
+        for (size_t i = 0; i < bundle_types.size(); ++i)
+        {
+            ASSERT_EQ(collection_types[i].type_name, bundle_types[i].type_name);
+            ASSERT_EQ(collection_types[i].type_identifier, bundle_types[i].type_identifier);
+            ASSERT_EQ(collection_types[i].type_object, bundle_types[i].type_object);
+        }
+
+        // Truncated bundles are rejected
+        ASSERT_FALSE(participants::serialization::deserialize_types(bundle.data(),
+                static_cast<uint32_t>(bundle.size() - 1), bundle_types));
+    }
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_type_format)
+{
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+
+    static std::vector<unsigned char> notified_types;
+    participants::CBWriter writer;
+    writer.set_type_notification_callback([](const char*, const char*, const unsigned char* serialized_type_internal,
+            uint32_t serialized_type_internal_size, const char*)
+            {
+                notified_types.assign(
+                    serialized_type_internal, serialized_type_internal + serialized_type_internal_size);
+            });
+
+    // Types are notified as serialized collections by default
+    writer.write_schema(dynamic_type, type_id);
+    participants::DynamicTypesCollection collection;
+    ASSERT_TRUE(participants::serialization::deserialize_dynamic_types(notified_types.data(),
+            static_cast<uint32_t>(notified_types.size()), collection));
+    ASSERT_FALSE(collection.dynamic_types().empty());
+
+    // And as type bundles if so configured
+    writer.set_type_format(participants::TypeFormat::TYPE_BUNDLE);
+    writer.write_schema(dynamic_type, type_id);
+    ASSERT_GE(notified_types.size(), 4u);
+    ASSERT_EQ(std::string(notified_types.begin(), notified_types.begin() + 4), "DETB");
+
+    std::vector<participants::serialization::DeserializedType> types;
+    ASSERT_TRUE(participants::serialization::deserialize_types(notified_types.data(),
+            static_cast<uint32_t>(notified_types.size()), types));
+    ASSERT_EQ(types.back().type_name, pipe_topic.type_name);
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_type_store)
+{
+    const std::string file_path = "ddsenabler_participants_type_store.bin";
+    std::remove(file_path.c_str());
+
+    std::vector<xtypes::TypeIdentifier> type_ids(3);
+    for (int num_type = 1; num_type <= 3; ++num_type)
+    {
+        DynamicType::_ref_type dynamic_type;
+        get_dynamic_type(num_type, dynamic_type, type_ids[num_type - 1]);
+    }
+
+    const std::vector<std::vector<unsigned char>> serialized_types {{1, 2, 3}, {4, 5, 6, 7}, {8}};
+
+    using StoredTypes = std::vector<std::pair<std::string, std::vector<unsigned char>>>;
+    auto load = [](participants::TypeStore& store, StoredTypes& stored_types)
+            {
+                return store.load(
+                    [&stored_types](const std::string& type_name, const unsigned char* data, uint32_t size)
+                    {
+                        stored_types.emplace_back(type_name, std::vector<unsigned char>(data, data + size));
+                    });
+            };
+
+    {
+        // A missing file is an empty store
+        participants::TypeStore store(file_path);
+        StoredTypes stored_types;
+        ASSERT_TRUE(load(store, stored_types));
+        ASSERT_TRUE(stored_types.empty());
+
+        ASSERT_TRUE(store.store(type_ids[0], "type1", serialized_types[0].data(), 3));
+        ASSERT_TRUE(store.store(type_ids[1], "type2", serialized_types[1].data(), 4));
+
+        // Types are only stored once
+        ASSERT_TRUE(store.store(type_ids[0], "type1", serialized_types[0].data(), 3));
+        ASSERT_EQ(store.size(), 2u);
+    }
+
+    // Leave an incomplete record at the end of the file, as an interrupted write would
+    {
+        std::ofstream ofs(file_path, std::ios::binary | std::ios::app);
+        const uint32_t record_size = 100;
+        ofs.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+        ofs.write("type", 4);
+    }
+
+    {
+        participants::TypeStore store(file_path);
+        StoredTypes stored_types;
+        ASSERT_TRUE(load(store, stored_types));
+        ASSERT_EQ(stored_types, StoredTypes({{"type1", serialized_types[0]}, {"type2", serialized_types[1]}}));
+        ASSERT_TRUE(store.contains(type_ids[0]));
+        ASSERT_TRUE(store.contains(type_ids[1]));
+        ASSERT_FALSE(store.contains(type_ids[2]));
+
+        ASSERT_TRUE(store.store(type_ids[2], "type3", serialized_types[2].data(), 1));
+    }
+
+    // Types stored after discarding the incomplete record are loaded
+    {
+        participants::TypeStore store(file_path);
+        StoredTypes stored_types;
+        ASSERT_TRUE(load(store, stored_types));
+        ASSERT_EQ(stored_types.size(), 3u);
+        ASSERT_EQ(stored_types[2], StoredTypes::value_type("type3", serialized_types[2]));
+    }
+
+    // Files that are not type stores are rejected
+    {
+        std::ofstream ofs(file_path, std::ios::binary | std::ios::trunc);
+        ofs << "not a type store";
+    }
+
+    {
+        participants::TypeStore store(file_path);
+        StoredTypes stored_types;
+        ASSERT_FALSE(load(store, stored_types));
+    }
+
+    std::remove(file_path.c_str());
+
+    // Types loaded by the handler are ready to use, without being notified again
+    {
+        xtypes::TypeIdentifier type_id;
+        DynamicType::_ref_type dynamic_type;
+        ddspipe::core::types::DdsTopic pipe_topic;
+        get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+
+        std::vector<unsigned char> bundle;
+        ASSERT_TRUE(participants::serialization::serialize_type_bundle(pipe_topic.type_name, type_id, bundle));
+        {
+            participants::TypeStore store(file_path);
+            ASSERT_TRUE(store.store(type_id, pipe_topic.type_name, bundle.data(), bundle.size()));
+        }
+
+        participants::CBHandlerConfiguration handler_config;
+        handler_config.type_store_path = file_path;
+        auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+        auto cb_handler_ = std::make_shared<CBHandlerTest>(handler_config, payload_pool_);
+
+        ASSERT_NE(cb_handler_->schemas_.find(pipe_topic.type_name), nullptr);
+        std::shared_ptr<const participants::TypeCodec> codec;
+        ASSERT_TRUE(cb_handler_->get_type_codec(pipe_topic.type_name, codec));
+        ASSERT_NE(codec, nullptr);
+
+        // The schema is not notified on first use
+        cb_handler_->add_schema(dynamic_type, type_id);
+        ASSERT_EQ(cb_handler_->type_called_, 0);
+        ASSERT_EQ(cb_handler_->type_query_called, 0);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_publish_serialized)
+{
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    std::shared_ptr<participants::EnablerParticipant> participant;
+    participants::TopicHandle handle;
+    create_enabler_participant(1, payload_pool_, participant, handle);
+
+    ddspipe::core::types::Payload payload;
+    get_filled_data_payload(1, DataRepresentationId::XCDR_DATA_REPRESENTATION, payload);
+    std::vector<unsigned char> sample(payload.data, payload.data + payload.length);
+    const uint16_t encapsulation = payload.encapsulation;
+
+    // A valid sample is injected as is
+    ASSERT_TRUE(participant->publish_serialized(handle, sample.data(), sample.size(), encapsulation));
+    auto published = take_published_sample(handle);
+    ASSERT_NE(published, nullptr);
+    ASSERT_EQ(published->payload.encapsulation, encapsulation);
+    ASSERT_EQ(std::vector<unsigned char>(published->payload.data, published->payload.data + published->payload.length),
+            sample);
+
+    // Unknown encapsulation header
+    for (const uint8_t representation : {0x04, 0x05, 0x0c, 0xff})
+    {
+        std::vector<unsigned char> bad_header = sample;
+        bad_header[1] = representation;
+        ASSERT_FALSE(participant->publish_serialized(handle, bad_header.data(), bad_header.size(), encapsulation));
+    }
+
+    // Payload truncated within the encapsulation header
+    ASSERT_FALSE(participant->publish_serialized(handle, sample.data(), 3, encapsulation));
+    ASSERT_FALSE(participant->publish_serialized(handle, sample.data(), 0, encapsulation));
+    ASSERT_FALSE(participant->publish_serialized(handle, nullptr, sample.size(), encapsulation));
+
+    // Encapsulation with a different endianness than the header
+    ASSERT_FALSE(participant->publish_serialized(handle, sample.data(), sample.size(), encapsulation ^ 0x0001));
+
+    // Payload larger than the maximum serialized size of the (bounded) type
+    ASSERT_TRUE(handle.codec->is_bounded());
+    std::vector<unsigned char> oversized = sample;
+    oversized.resize(handle.codec->max_serialized_size() + 1);
+    ASSERT_FALSE(participant->publish_serialized(handle, oversized.data(), oversized.size(), encapsulation));
+
+    // Nothing is injected when the validation fails
+    ASSERT_EQ(take_published_sample(handle), nullptr);
+
+    // Unless the validation is skipped
+    std::vector<unsigned char> bad_header = sample;
+    bad_header[1] = 0x04;
+    ASSERT_TRUE(participant->publish_serialized(handle, bad_header.data(), bad_header.size(), encapsulation, false));
+    ASSERT_NE(take_published_sample(handle), nullptr);
+
+    // Unresolved handles are rejected
+    ASSERT_FALSE(participant->publish_serialized(participants::TopicHandle(), sample.data(), sample.size(),
+            encapsulation));
+
+    // Published payloads are returned to the pool once the samples are released
+    ASSERT_FALSE(payload_pool_->is_clean());
+    published.reset();
+    ASSERT_TRUE(payload_pool_->is_clean());
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_publish_json)
+{
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    std::shared_ptr<participants::EnablerParticipant> participant;
+    participants::TopicHandle handle;
+    create_enabler_participant(1, payload_pool_, participant, handle);
+
+    ddspipe::core::types::Payload payload;
+    get_filled_data_payload(1, DataRepresentationId::XCDR_DATA_REPRESENTATION, payload);
+    std::vector<unsigned char> sample(payload.data, payload.data + payload.length);
+
+    // Samples are serialized straight into payloads of the pool
+    ASSERT_TRUE(participant->publish(handle, "{\"value\": 42}"));
+    auto published = take_published_sample(handle);
+    ASSERT_NE(published, nullptr);
+    ASSERT_EQ(published->payload_owner, payload_pool_.get());
+    ASSERT_EQ(std::vector<unsigned char>(published->payload.data, published->payload.data + published->payload.length),
+            sample);
+
+    std::vector<bool> results;
+    ASSERT_TRUE(participant->publish_batch(handle, {"{\"value\": 42}", "{\"value\": 43}"}, results));
+    ASSERT_NE(take_published_sample(handle), nullptr);
+    ASSERT_NE(take_published_sample(handle), nullptr);
+
+    // Failed serializations reserve nothing
+    ASSERT_FALSE(participant->publish(handle, "not json"));
+    ASSERT_EQ(take_published_sample(handle), nullptr);
+
+    // Published payloads are returned to the pool once the samples are released
+    ASSERT_FALSE(payload_pool_->is_clean());
+    published.reset();
+    ASSERT_TRUE(payload_pool_->is_clean());
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_publish_topic_data_representation)
+{
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    xtypes::TypeIdentifier type_id;
+    DynamicType::_ref_type dynamic_type;
+    ddspipe::core::types::DdsTopic pipe_topic;
+    get_dynamic_type(1, dynamic_type, type_id, pipe_topic);
+
+    // Topics publish in XCDR1 unless configured otherwise
+    {
+        std::shared_ptr<participants::EnablerParticipant> participant;
+        participants::TopicHandle handle;
+        create_enabler_participant(1, payload_pool_, participant, handle);
+        ASSERT_EQ(handle.data_representation, DataRepresentationId::XCDR_DATA_REPRESENTATION);
+    }
+
+    auto configuration = std::make_shared<participants::EnablerParticipantConfiguration>();
+    configuration->topic_data_representations[pipe_topic.m_topic_name] =
+            DataRepresentationId::XCDR2_DATA_REPRESENTATION;
+
+    std::shared_ptr<participants::EnablerParticipant> participant;
+    participants::TopicHandle handle;
+    create_enabler_participant(1, payload_pool_, participant, handle, configuration);
+    ASSERT_EQ(handle.data_representation, DataRepresentationId::XCDR2_DATA_REPRESENTATION);
+
+    // Expected sample, serialized in XCDR2 by Fast DDS
+    const std::string json = "{\"value\": 42}";
+    DynamicData::_ref_type dyn_data = DynamicDataFactory::get_instance()->create_data(dynamic_type);
+    ASSERT_EQ(dyn_data->set_int16_value(dyn_data->get_member_id_by_name("value"), 42), RETCODE_OK);
+
+    DynamicPubSubType pubsub_type(dynamic_type);
+    ddspipe::core::types::Payload expected_payload;
+    expected_payload.reserve(pubsub_type.calculate_serialized_size(&dyn_data,
+            DataRepresentationId::XCDR2_DATA_REPRESENTATION));
+    ASSERT_TRUE(pubsub_type.serialize(&dyn_data, expected_payload, DataRepresentationId::XCDR2_DATA_REPRESENTATION));
+    const std::vector<unsigned char> expected(expected_payload.data,
+            expected_payload.data + expected_payload.length);
+
+    // Published samples are serialized with the representation of their topic
+    ASSERT_TRUE(participant->publish(handle, json));
+    {
+        auto published = take_published_sample(handle);
+        ASSERT_NE(published, nullptr);
+        ASSERT_EQ(published->payload.encapsulation, expected_payload.encapsulation);
+        ASSERT_EQ(std::vector<unsigned char>(published->payload.data,
+                published->payload.data + published->payload.length), expected);
+    }
+
+    // Both the direct encoder and the DynamicData fallback give the same bytes
+    ASSERT_NE(handle.codec->encoder(), nullptr);
+    ddspipe::core::types::Payload encoded_payload;
+    ASSERT_TRUE(handle.codec->encoder()->encode(json, DataRepresentationId::XCDR2_DATA_REPRESENTATION,
+            *payload_pool_, encoded_payload));
+    ASSERT_EQ(encoded_payload.encapsulation, expected_payload.encapsulation);
+    ASSERT_EQ(std::vector<unsigned char>(encoded_payload.data, encoded_payload.data + encoded_payload.length),
+            expected);
+    payload_pool_->release_payload(encoded_payload);
+
+    ddspipe::core::types::Payload fallback_payload;
+    ASSERT_TRUE(handle.codec->serialize(dyn_data, DataRepresentationId::XCDR2_DATA_REPRESENTATION, *payload_pool_,
+            fallback_payload));
+    ASSERT_EQ(fallback_payload.encapsulation, expected_payload.encapsulation);
+    ASSERT_EQ(std::vector<unsigned char>(fallback_payload.data, fallback_payload.data + fallback_payload.length),
+            expected);
+    payload_pool_->release_payload(fallback_payload);
+
+    ASSERT_TRUE(payload_pool_->is_clean());
+}
+
+TEST(DdsEnablerParticipantsTest, ddsenabler_participants_payload_loan)
+{
+    auto payload_pool_ = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    std::shared_ptr<participants::EnablerParticipant> participant;
+    participants::TopicHandle handle;
+    create_enabler_participant(1, payload_pool_, participant, handle);
+
+    ddspipe::core::types::Payload payload;
+    get_filled_data_payload(1, DataRepresentationId::XCDR_DATA_REPRESENTATION, payload);
+    std::vector<unsigned char> sample(payload.data, payload.data + payload.length);
+    const uint16_t encapsulation = payload.encapsulation;
+
+    // Invalid requests
+    {
+        participants::PayloadLoan loan;
+        ASSERT_FALSE(participant->loan_payload(participants::TopicHandle(), sample.size(), loan));
+        ASSERT_FALSE(participant->loan_payload(handle, 0, loan));
+        ASSERT_FALSE(loan.valid());
+        ASSERT_EQ(loan.data(), nullptr);
+        ASSERT_FALSE(loan.set_size(1));
+        ASSERT_FALSE(participant->commit_payload(loan, encapsulation));
+    }
+
+    // Loan dropped without commit returns its payload to the pool
+    {
+        participants::PayloadLoan loan;
+        ASSERT_TRUE(participant->loan_payload(handle, sample.size(), loan));
+        ASSERT_TRUE(loan.valid());
+        ASSERT_FALSE(payload_pool_->is_clean());
+    }
+    ASSERT_TRUE(payload_pool_->is_clean());
+    ASSERT_EQ(take_published_sample(handle), nullptr);
+
+    // Loan serialized in and committed
+    {
+        participants::PayloadLoan loan;
+        ASSERT_TRUE(participant->loan_payload(handle, sample.size() + 8, loan));
+        ASSERT_EQ(loan.size(), sample.size() + 8);
+        ASSERT_GE(loan.capacity(), loan.size());
+        ASSERT_EQ(loan.topic().topic_name, handle.topic_name);
+        std::memcpy(loan.data(), sample.data(), sample.size());
+
+        // Sizes beyond the capacity or empty are rejected
+        ASSERT_FALSE(loan.set_size(loan.capacity() + 1));
+        ASSERT_FALSE(loan.set_size(0));
+        ASSERT_TRUE(loan.set_size(sample.size()));
+        ASSERT_EQ(loan.size(), sample.size());
+
+        // A sample failing the validation keeps the loan
+        loan.data()[1] = 0x04;
+        ASSERT_FALSE(participant->commit_payload(loan, encapsulation));
+        ASSERT_TRUE(loan.valid());
+        loan.data()[1] = sample[1];
+
+        ASSERT_TRUE(participant->commit_payload(loan, encapsulation));
+        ASSERT_FALSE(loan.valid());
+        ASSERT_FALSE(participant->commit_payload(loan, encapsulation));
+
+        auto published = take_published_sample(handle);
+        ASSERT_NE(published, nullptr);
+        ASSERT_EQ(published->payload.encapsulation, encapsulation);
+        ASSERT_EQ(std::vector<unsigned char>(published->payload.data,
+                published->payload.data + published->payload.length), sample);
+    }
+
+    // The committed payload is returned to the pool once the published sample is released
+    ASSERT_TRUE(payload_pool_->is_clean());
+}
+
 int main(
         int argc,
         char** argv)
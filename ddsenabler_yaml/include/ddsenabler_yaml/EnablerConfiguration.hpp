@@ -29,6 +29,7 @@
 
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 
+#include <ddsenabler_participants/CBHandlerConfiguration.hpp>
 #include <ddsenabler_participants/EnablerParticipantConfiguration.hpp>
 
 #include <ddspipe_yaml/Yaml.hpp>
@@ -70,6 +71,9 @@ public:
     std::shared_ptr<ddspipe::participants::SimpleParticipantConfiguration> simple_configuration;
     std::shared_ptr<ddsenabler::participants::EnablerParticipantConfiguration> enabler_configuration;
 
+    // CB Handler configuration
+    ddsenabler::participants::CBHandlerConfiguration handler_configuration;
+
     unsigned int n_threads = DEFAULT_N_THREADS;
 
     ddspipe::core::types::TopicQoS topic_qos{};
@@ -28,6 +28,34 @@ namespace yaml {
 constexpr const char* ENABLER_DDS_TAG("dds");
 constexpr const char* ENABLER_ENABLER_TAG("ddsenabler");
 constexpr const char* ENABLER_INITIAL_PUBLISH_WAIT_TAG("initial-publish-wait");
+constexpr const char* ENABLER_INITIAL_PUBLISH_MATCHED_READERS_TAG("initial-publish-matched-readers");
+constexpr const char* ENABLER_PUBLISH_TOPICS_TAG("publish-topics");
+constexpr const char* ENABLER_DATA_REPRESENTATION_TAG("data-representation");
+constexpr const char* ENABLER_DATA_REPRESENTATION_DEFAULT_TAG("default");
+constexpr const char* ENABLER_DATA_REPRESENTATION_XCDR1_TOPICS_TAG("xcdr1-topics");
+constexpr const char* ENABLER_DATA_REPRESENTATION_XCDR2_TOPICS_TAG("xcdr2-topics");
+constexpr const char* ENABLER_DATA_REPRESENTATION_XCDR1_TAG("xcdr1");
+constexpr const char* ENABLER_DATA_REPRESENTATION_XCDR2_TAG("xcdr2");
+constexpr const char* ENABLER_DYNAMIC_DATA_POOL_SIZE_TAG("dynamic-data-pool-size");
+constexpr const char* ENABLER_TYPE_STORE_TAG("type-store");
+constexpr const char* ENABLER_TYPE_FORMAT_TAG("type-format");
+constexpr const char* ENABLER_TYPE_FORMAT_DYNAMIC_TYPES_COLLECTION_TAG("dynamic-types-collection");
+constexpr const char* ENABLER_TYPE_FORMAT_TYPE_BUNDLE_TAG("type-bundle");
+constexpr const char* ENABLER_SCHEMA_NOTIFICATION_THREADS_TAG("schema-notification-threads");
+constexpr const char* ENABLER_UNKNOWN_TYPE_TTL_TAG("unknown-type-ttl");
+constexpr const char* ENABLER_DATA_BATCH_TAG("data-batch");
+constexpr const char* ENABLER_DATA_BATCH_MAX_SAMPLES_TAG("max-samples");
+constexpr const char* ENABLER_DATA_BATCH_MAX_BYTES_TAG("max-bytes");
+constexpr const char* ENABLER_DATA_BATCH_MAX_LATENCY_TAG("max-latency");
+constexpr const char* ENABLER_DELIVERY_QUEUE_TAG("delivery-queue");
+constexpr const char* ENABLER_DELIVERY_QUEUE_SIZE_TAG("size");
+constexpr const char* ENABLER_DELIVERY_QUEUE_POLICY_TAG("policy");
+constexpr const char* ENABLER_DELIVERY_QUEUE_THREADS_TAG("threads");
+constexpr const char* ENABLER_DELIVERY_QUEUE_COALESCED_TOPICS_TAG("coalesced-topics");
+constexpr const char* ENABLER_DELIVERY_POLICY_BLOCK_TAG("block");
+constexpr const char* ENABLER_DELIVERY_POLICY_DROP_OLDEST_TAG("drop-oldest");
+constexpr const char* ENABLER_DELIVERY_POLICY_DROP_NEWEST_TAG("drop-newest");
+constexpr const char* ENABLER_DELIVERY_POLICY_KEEP_LAST_PER_INSTANCE_TAG("keep-last-per-instance");
 
 } /* namespace yaml */
 } /* namespace ddsenabler */
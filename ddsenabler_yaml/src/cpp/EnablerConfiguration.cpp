@@ -247,6 +247,158 @@ void EnablerConfiguration::load_enabler_configuration_(
         enabler_configuration->initial_publish_wait = YamlReader::get_nonnegative_int(yml,
                         ENABLER_INITIAL_PUBLISH_WAIT_TAG);
     }
+
+    // Get number of matched readers the initial publish waits for
+    if (YamlReader::is_tag_present(yml, ENABLER_INITIAL_PUBLISH_MATCHED_READERS_TAG))
+    {
+        enabler_configuration->initial_publish_matched_readers = YamlReader::get_nonnegative_int(yml,
+                        ENABLER_INITIAL_PUBLISH_MATCHED_READERS_TAG);
+    }
+
+    // Get topics to be created at startup
+    if (YamlReader::is_tag_present(yml, ENABLER_PUBLISH_TOPICS_TAG))
+    {
+        enabler_configuration->publish_topics = YamlReader::get_set<std::string>(yml, ENABLER_PUBLISH_TOPICS_TAG,
+                        version);
+    }
+
+    // Get data representation of the published samples
+    if (YamlReader::is_tag_present(yml, ENABLER_DATA_REPRESENTATION_TAG))
+    {
+        auto representation_yml = YamlReader::get_value_in_tag(yml, ENABLER_DATA_REPRESENTATION_TAG);
+
+        if (YamlReader::is_tag_present(representation_yml, ENABLER_DATA_REPRESENTATION_DEFAULT_TAG))
+        {
+            enabler_configuration->data_representation =
+                    YamlReader::get_enumeration<fastdds::dds::DataRepresentationId_t>(
+                representation_yml,
+                ENABLER_DATA_REPRESENTATION_DEFAULT_TAG,
+                {
+                    {ENABLER_DATA_REPRESENTATION_XCDR1_TAG, fastdds::dds::XCDR_DATA_REPRESENTATION},
+                    {ENABLER_DATA_REPRESENTATION_XCDR2_TAG, fastdds::dds::XCDR2_DATA_REPRESENTATION}
+                });
+        }
+
+        if (YamlReader::is_tag_present(representation_yml, ENABLER_DATA_REPRESENTATION_XCDR1_TOPICS_TAG))
+        {
+            for (const auto& topic_name : YamlReader::get_set<std::string>(representation_yml,
+                    ENABLER_DATA_REPRESENTATION_XCDR1_TOPICS_TAG, version))
+            {
+                enabler_configuration->topic_data_representations[topic_name] = fastdds::dds::XCDR_DATA_REPRESENTATION;
+            }
+        }
+
+        if (YamlReader::is_tag_present(representation_yml, ENABLER_DATA_REPRESENTATION_XCDR2_TOPICS_TAG))
+        {
+            for (const auto& topic_name : YamlReader::get_set<std::string>(representation_yml,
+                    ENABLER_DATA_REPRESENTATION_XCDR2_TOPICS_TAG, version))
+            {
+                enabler_configuration->topic_data_representations[topic_name] = fastdds::dds::XCDR2_DATA_REPRESENTATION;
+            }
+        }
+    }
+
+    // Get DynamicData pool size
+    if (YamlReader::is_tag_present(yml, ENABLER_DYNAMIC_DATA_POOL_SIZE_TAG))
+    {
+        handler_configuration.dynamic_data_pool_size = YamlReader::get_nonnegative_int(yml,
+                        ENABLER_DYNAMIC_DATA_POOL_SIZE_TAG);
+    }
+
+    // Get type store file
+    if (YamlReader::is_tag_present(yml, ENABLER_TYPE_STORE_TAG))
+    {
+        handler_configuration.type_store_path = YamlReader::get<std::string>(yml, ENABLER_TYPE_STORE_TAG, version);
+    }
+
+    // Get format of the notified types
+    if (YamlReader::is_tag_present(yml, ENABLER_TYPE_FORMAT_TAG))
+    {
+        handler_configuration.type_format = YamlReader::get_enumeration<participants::TypeFormat>(
+            yml,
+            ENABLER_TYPE_FORMAT_TAG,
+            {
+                {ENABLER_TYPE_FORMAT_DYNAMIC_TYPES_COLLECTION_TAG,
+                 participants::TypeFormat::DYNAMIC_TYPES_COLLECTION},
+                {ENABLER_TYPE_FORMAT_TYPE_BUNDLE_TAG, participants::TypeFormat::TYPE_BUNDLE}
+            });
+    }
+
+    // Get number of threads notifying new schemas in the background
+    if (YamlReader::is_tag_present(yml, ENABLER_SCHEMA_NOTIFICATION_THREADS_TAG))
+    {
+        handler_configuration.schema_notification_threads = YamlReader::get_nonnegative_int(yml,
+                        ENABLER_SCHEMA_NOTIFICATION_THREADS_TAG);
+    }
+
+    // Get time the types the user failed to provide are not queried again
+    if (YamlReader::is_tag_present(yml, ENABLER_UNKNOWN_TYPE_TTL_TAG))
+    {
+        handler_configuration.unknown_type_ttl = YamlReader::get_nonnegative_int(yml,
+                        ENABLER_UNKNOWN_TYPE_TTL_TAG);
+    }
+
+    // Get batched data notification limits
+    if (YamlReader::is_tag_present(yml, ENABLER_DATA_BATCH_TAG))
+    {
+        auto batch_yml = YamlReader::get_value_in_tag(yml, ENABLER_DATA_BATCH_TAG);
+
+        if (YamlReader::is_tag_present(batch_yml, ENABLER_DATA_BATCH_MAX_SAMPLES_TAG))
+        {
+            handler_configuration.data_batch_max_samples = YamlReader::get_positive_int(batch_yml,
+                            ENABLER_DATA_BATCH_MAX_SAMPLES_TAG);
+        }
+
+        if (YamlReader::is_tag_present(batch_yml, ENABLER_DATA_BATCH_MAX_BYTES_TAG))
+        {
+            handler_configuration.data_batch_max_bytes = YamlReader::get_positive_int(batch_yml,
+                            ENABLER_DATA_BATCH_MAX_BYTES_TAG);
+        }
+
+        if (YamlReader::is_tag_present(batch_yml, ENABLER_DATA_BATCH_MAX_LATENCY_TAG))
+        {
+            handler_configuration.data_batch_max_latency = YamlReader::get_positive_int(batch_yml,
+                            ENABLER_DATA_BATCH_MAX_LATENCY_TAG);
+        }
+    }
+
+    // Get delivery queue configuration
+    if (YamlReader::is_tag_present(yml, ENABLER_DELIVERY_QUEUE_TAG))
+    {
+        auto queue_yml = YamlReader::get_value_in_tag(yml, ENABLER_DELIVERY_QUEUE_TAG);
+
+        if (YamlReader::is_tag_present(queue_yml, ENABLER_DELIVERY_QUEUE_SIZE_TAG))
+        {
+            handler_configuration.delivery_queue_size = YamlReader::get_nonnegative_int(queue_yml,
+                            ENABLER_DELIVERY_QUEUE_SIZE_TAG);
+        }
+
+        if (YamlReader::is_tag_present(queue_yml, ENABLER_DELIVERY_QUEUE_POLICY_TAG))
+        {
+            handler_configuration.delivery_policy = YamlReader::get_enumeration<participants::DeliveryPolicy>(
+                queue_yml,
+                ENABLER_DELIVERY_QUEUE_POLICY_TAG,
+                {
+                    {ENABLER_DELIVERY_POLICY_BLOCK_TAG, participants::DeliveryPolicy::BLOCK},
+                    {ENABLER_DELIVERY_POLICY_DROP_OLDEST_TAG, participants::DeliveryPolicy::DROP_OLDEST},
+                    {ENABLER_DELIVERY_POLICY_DROP_NEWEST_TAG, participants::DeliveryPolicy::DROP_NEWEST},
+                    {ENABLER_DELIVERY_POLICY_KEEP_LAST_PER_INSTANCE_TAG,
+                     participants::DeliveryPolicy::KEEP_LAST_PER_INSTANCE}
+                });
+        }
+
+        if (YamlReader::is_tag_present(queue_yml, ENABLER_DELIVERY_QUEUE_THREADS_TAG))
+        {
+            handler_configuration.delivery_threads = YamlReader::get_positive_int(queue_yml,
+                            ENABLER_DELIVERY_QUEUE_THREADS_TAG);
+        }
+
+        if (YamlReader::is_tag_present(queue_yml, ENABLER_DELIVERY_QUEUE_COALESCED_TOPICS_TAG))
+        {
+            handler_configuration.coalesced_topics = YamlReader::get_set<std::string>(queue_yml,
+                            ENABLER_DELIVERY_QUEUE_COALESCED_TOPICS_TAG, version);
+        }
+    }
 }
 
 void EnablerConfiguration::load_specs_configuration_(
@@ -33,6 +33,24 @@ TEST(DdsEnablerYamlTest, get_ddsenabler_correct_configuration_yaml)
 
             ddsenabler:
                 initial-publish-wait: 500
+                initial-publish-matched-readers: 2
+                publish-topics: ["rt/cmd_vel", "rt/goal"]
+                data-representation:
+                    default: xcdr2
+                    xcdr1-topics: ["rt/cmd_vel"]
+                dynamic-data-pool-size: 16
+                type-store: "/tmp/ddsenabler_types.bin"
+                type-format: type-bundle
+                schema-notification-threads: 2
+                unknown-type-ttl: 5000
+                data-batch:
+                    max-samples: 32
+                    max-latency: 5
+                delivery-queue:
+                    size: 100
+                    policy: keep-last-per-instance
+                    threads: 2
+                    coalesced-topics: ["rt/pose*", "rt/battery"]
 
             specs:
               threads: 12
@@ -55,6 +73,27 @@ TEST(DdsEnablerYamlTest, get_ddsenabler_correct_configuration_yaml)
 
     ASSERT_EQ(configuration.simple_configuration->domain.domain_id, 4);
     ASSERT_EQ(configuration.enabler_configuration->initial_publish_wait, 500);
+    ASSERT_EQ(configuration.enabler_configuration->initial_publish_matched_readers, 2);
+    ASSERT_EQ(configuration.enabler_configuration->publish_topics, std::set<std::string>({"rt/cmd_vel", "rt/goal"}));
+    ASSERT_EQ(configuration.enabler_configuration->data_representation,
+            eprosima::fastdds::dds::XCDR2_DATA_REPRESENTATION);
+    ASSERT_EQ(configuration.enabler_configuration->topic_data_representations.size(), 1u);
+    ASSERT_EQ(configuration.enabler_configuration->topic_data_representations.at("rt/cmd_vel"),
+            eprosima::fastdds::dds::XCDR_DATA_REPRESENTATION);
+    ASSERT_EQ(configuration.handler_configuration.dynamic_data_pool_size, 16);
+    ASSERT_EQ(configuration.handler_configuration.type_store_path, "/tmp/ddsenabler_types.bin");
+    ASSERT_EQ(configuration.handler_configuration.type_format, ddsenabler::participants::TypeFormat::TYPE_BUNDLE);
+    ASSERT_EQ(configuration.handler_configuration.schema_notification_threads, 2);
+    ASSERT_EQ(configuration.handler_configuration.unknown_type_ttl, 5000);
+    ASSERT_EQ(configuration.handler_configuration.data_batch_max_samples, 32);
+    ASSERT_EQ(configuration.handler_configuration.data_batch_max_bytes,
+            ddsenabler::participants::CBHandlerConfiguration().data_batch_max_bytes);
+    ASSERT_EQ(configuration.handler_configuration.data_batch_max_latency, 5);
+    ASSERT_EQ(configuration.handler_configuration.delivery_queue_size, 100);
+    ASSERT_EQ(configuration.handler_configuration.delivery_policy,
+            ddsenabler::participants::DeliveryPolicy::KEEP_LAST_PER_INSTANCE);
+    ASSERT_EQ(configuration.handler_configuration.delivery_threads, 2);
+    ASSERT_EQ(configuration.handler_configuration.coalesced_topics, std::set<std::string>({"rt/pose*", "rt/battery"}));
     ASSERT_EQ(configuration.n_threads, 12);
 
     ASSERT_TRUE(configuration.ddspipe_configuration.log_configuration.is_valid(error_msg));
@@ -119,6 +158,19 @@ TEST(DdsEnablerYamlTest, get_ddsenabler_default_values_configuration_yaml)
 
     ASSERT_EQ(configuration.simple_configuration->domain.domain_id, 0);
     ASSERT_EQ(configuration.enabler_configuration->initial_publish_wait, 0);
+    ASSERT_EQ(configuration.enabler_configuration->initial_publish_matched_readers, 1);
+    ASSERT_TRUE(configuration.enabler_configuration->publish_topics.empty());
+    ASSERT_EQ(configuration.enabler_configuration->data_representation,
+            eprosima::fastdds::dds::XCDR_DATA_REPRESENTATION);
+    ASSERT_TRUE(configuration.enabler_configuration->topic_data_representations.empty());
+    ASSERT_EQ(configuration.handler_configuration.dynamic_data_pool_size,
+            ddsenabler::participants::CBHandlerConfiguration().dynamic_data_pool_size);
+    ASSERT_TRUE(configuration.handler_configuration.type_store_path.empty());
+    ASSERT_EQ(configuration.handler_configuration.type_format,
+            ddsenabler::participants::TypeFormat::DYNAMIC_TYPES_COLLECTION);
+    ASSERT_EQ(configuration.handler_configuration.schema_notification_threads, 0);
+    ASSERT_EQ(configuration.handler_configuration.unknown_type_ttl, 0);
+    ASSERT_EQ(configuration.handler_configuration.delivery_queue_size, 0);
     ASSERT_EQ(configuration.n_threads, DEFAULT_N_THREADS);
 }
 
@@ -178,6 +230,19 @@ TEST(DdsEnablerYamlTest, get_ddsenabler_default_values_configuration_json)
 
     ASSERT_EQ(configuration.simple_configuration->domain.domain_id, 0);
     ASSERT_EQ(configuration.enabler_configuration->initial_publish_wait, 0);
+    ASSERT_EQ(configuration.enabler_configuration->initial_publish_matched_readers, 1);
+    ASSERT_TRUE(configuration.enabler_configuration->publish_topics.empty());
+    ASSERT_EQ(configuration.enabler_configuration->data_representation,
+            eprosima::fastdds::dds::XCDR_DATA_REPRESENTATION);
+    ASSERT_TRUE(configuration.enabler_configuration->topic_data_representations.empty());
+    ASSERT_EQ(configuration.handler_configuration.dynamic_data_pool_size,
+            ddsenabler::participants::CBHandlerConfiguration().dynamic_data_pool_size);
+    ASSERT_TRUE(configuration.handler_configuration.type_store_path.empty());
+    ASSERT_EQ(configuration.handler_configuration.type_format,
+            ddsenabler::participants::TypeFormat::DYNAMIC_TYPES_COLLECTION);
+    ASSERT_EQ(configuration.handler_configuration.schema_notification_threads, 0);
+    ASSERT_EQ(configuration.handler_configuration.unknown_type_ttl, 0);
+    ASSERT_EQ(configuration.handler_configuration.delivery_queue_size, 0);
     ASSERT_EQ(configuration.n_threads, DEFAULT_N_THREADS);
 }
 